@@ -1,31 +1,30 @@
 #define DUCKDB_EXTENSION_MAIN
 
+#include "astro.hpp"
 #include "astro_extension.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/function/function_set.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/vector_operations/ternary_executor.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/vector.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 
 #include <cmath>
-#include <sstream>
-#include <iomanip>
-
-// Windows MSVC doesn't define M_PI by default
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+#include <cstring>
 
 namespace duckdb {
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
-constexpr double DEG_TO_RAD = 0.017453292519943295;  // M_PI / 180
-constexpr double RAD_TO_DEG = 57.29577951308232;     // 180 / M_PI
+// DEG_TO_RAD / RAD_TO_DEG live in astro.hpp so every conversion site shares
+// the same folded literal.
 
 // Physical constants (IAU 2015 nominal values where applicable)
 constexpr double CONST_C = 299792458.0;              // m/s
@@ -41,6 +40,7 @@ constexpr double CONST_LY = 9.4607304725808e15;      // m
 constexpr double CONST_SIGMA_SB = 5.670374419e-8;    // W/(m^2*K^4)
 constexpr double CONST_M_JUPITER = 1.898e27;         // kg
 constexpr double CONST_R_JUPITER = 6.9911e7;         // m
+constexpr double CONST_C_KM = CONST_C * 1e-3;        // km/s, folded for the Hubble-law kernels
 constexpr double JULIAN_DAY_SECONDS = 86400.0;
 constexpr double SECTOR_BASE_SIZE_M = 1e12;          // 1 trillion meters at level 0
 
@@ -54,90 +54,167 @@ constexpr double GAL_LON_NCP = 2.1455716467163547;   // 122.932° in rad
 // ============================================================================
 // TYPE DEFINITIONS
 // ============================================================================
-static LogicalType GetAstroPosType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"x_m", LogicalType::DOUBLE},
-        {"y_m", LogicalType::DOUBLE},
-        {"z_m", LogicalType::DOUBLE},
-        {"frame", LogicalType::VARCHAR}
-    });
-    return type;
-}
-
-static LogicalType GetAstroVelType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"vx_ms", LogicalType::DOUBLE},
-        {"vy_ms", LogicalType::DOUBLE},
-        {"vz_ms", LogicalType::DOUBLE},
-        {"frame", LogicalType::VARCHAR}
-    });
-    return type;
-}
-
-static LogicalType GetAstroOrbitType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"a_m", LogicalType::DOUBLE},
-        {"e", LogicalType::DOUBLE},
-        {"i_rad", LogicalType::DOUBLE},
-        {"omega_rad", LogicalType::DOUBLE},
-        {"w_rad", LogicalType::DOUBLE},
-        {"M0_rad", LogicalType::DOUBLE},
-        {"epoch_jd", LogicalType::DOUBLE},
-        {"central_mass_kg", LogicalType::DOUBLE},
-        {"frame", LogicalType::VARCHAR}
-    });
-    return type;
-}
-
-static LogicalType GetAstroSectorIdType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"x", LogicalType::BIGINT},
-        {"y", LogicalType::BIGINT},
-        {"z", LogicalType::BIGINT},
-        {"level", LogicalType::INTEGER}
-    });
-    return type;
-}
-
-static LogicalType GetBodyType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"mass_kg", LogicalType::DOUBLE},
-        {"radius_m", LogicalType::DOUBLE},
-        {"luminosity_w", LogicalType::DOUBLE},
-        {"temperature_k", LogicalType::DOUBLE},
-        {"density_kg_m3", LogicalType::DOUBLE},
-        {"body_type", LogicalType::VARCHAR}
-    });
-    return type;
-}
-
-static LogicalType GetSectorBoundsType() {
-    static LogicalType type = LogicalType::STRUCT({
-        {"min_x_m", LogicalType::DOUBLE},
-        {"max_x_m", LogicalType::DOUBLE},
-        {"min_y_m", LogicalType::DOUBLE},
-        {"max_y_m", LogicalType::DOUBLE},
-        {"min_z_m", LogicalType::DOUBLE},
-        {"max_z_m", LogicalType::DOUBLE}
-    });
-    return type;
+// STRUCT return types are built once at extension load as file-scope
+// constants; the accessors below are plain reference returns with no
+// function-local static init guard on the call path.
+static const LogicalType ASTRO_POS_TYPE = LogicalType::STRUCT({
+    {"x_m", LogicalType::DOUBLE},
+    {"y_m", LogicalType::DOUBLE},
+    {"z_m", LogicalType::DOUBLE},
+    {"frame", LogicalType::VARCHAR}
+});
+
+static const LogicalType ASTRO_VEL_TYPE = LogicalType::STRUCT({
+    {"vx_ms", LogicalType::DOUBLE},
+    {"vy_ms", LogicalType::DOUBLE},
+    {"vz_ms", LogicalType::DOUBLE},
+    {"frame", LogicalType::VARCHAR}
+});
+
+static const LogicalType ASTRO_ORBIT_TYPE = LogicalType::STRUCT({
+    {"a_m", LogicalType::DOUBLE},
+    {"e", LogicalType::DOUBLE},
+    {"i_rad", LogicalType::DOUBLE},
+    {"omega_rad", LogicalType::DOUBLE},
+    {"w_rad", LogicalType::DOUBLE},
+    {"M0_rad", LogicalType::DOUBLE},
+    {"epoch_jd", LogicalType::DOUBLE},
+    {"central_mass_kg", LogicalType::DOUBLE},
+    {"frame", LogicalType::VARCHAR}
+});
+
+static const LogicalType ASTRO_SECTOR_ID_TYPE = LogicalType::STRUCT({
+    {"x", LogicalType::BIGINT},
+    {"y", LogicalType::BIGINT},
+    {"z", LogicalType::BIGINT},
+    {"level", LogicalType::INTEGER}
+});
+
+static const LogicalType ASTRO_BODY_TYPE = LogicalType::STRUCT({
+    {"mass_kg", LogicalType::DOUBLE},
+    {"radius_m", LogicalType::DOUBLE},
+    {"luminosity_w", LogicalType::DOUBLE},
+    {"temperature_k", LogicalType::DOUBLE},
+    {"density_kg_m3", LogicalType::DOUBLE},
+    {"body_type", LogicalType::VARCHAR}
+});
+
+static const LogicalType ASTRO_SECTOR_BOUNDS_TYPE = LogicalType::STRUCT({
+    {"min_x_m", LogicalType::DOUBLE},
+    {"max_x_m", LogicalType::DOUBLE},
+    {"min_y_m", LogicalType::DOUBLE},
+    {"max_y_m", LogicalType::DOUBLE},
+    {"min_z_m", LogicalType::DOUBLE},
+    {"max_z_m", LogicalType::DOUBLE}
+});
+
+static const LogicalType &GetAstroPosType() {
+    return ASTRO_POS_TYPE;
+}
+
+static const LogicalType &GetAstroVelType() {
+    return ASTRO_VEL_TYPE;
+}
+
+static const LogicalType &GetAstroOrbitType() {
+    return ASTRO_ORBIT_TYPE;
+}
+
+static const LogicalType &GetAstroSectorIdType() {
+    return ASTRO_SECTOR_ID_TYPE;
+}
+
+static const LogicalType &GetBodyType() {
+    return ASTRO_BODY_TYPE;
+}
+
+static const LogicalType &GetSectorBoundsType() {
+    return ASTRO_SECTOR_BOUNDS_TYPE;
+}
+
+static const LogicalType ASTRO_COSMO_DISTANCES_TYPE = LogicalType::STRUCT({
+    {"d_l_mpc", LogicalType::DOUBLE},
+    {"d_c_mpc", LogicalType::DOUBLE}
+});
+
+static const LogicalType &GetCosmoDistancesType() {
+    return ASTRO_COSMO_DISTANCES_TYPE;
 }
 
 // ============================================================================
 // MATH HELPERS
 // ============================================================================
-struct Vec3 {
-    double x, y, z;
-    Vec3() : x(0), y(0), z(0) {}
-    Vec3(double x_, double y_, double z_) : x(x_), y(y_), z(z_) {}
-
-    Vec3 operator+(const Vec3 &o) const { return {x + o.x, y + o.y, z + o.z}; }
-    Vec3 operator-(const Vec3 &o) const { return {x - o.x, y - o.y, z - o.z}; }
-    Vec3 operator*(double s) const { return {x * s, y * s, z * s}; }
-    double dot(const Vec3 &o) const { return x * o.x + y * o.y + z * o.z; }
-    double length() const { return sqrt(x * x + y * y + z * z); }
-    double length2() const { return x * x + y * y + z * z; }
-};
+// Vec3 lives in astro.hpp; geometry helpers below return it by value.
+
+// Joint sin/cos of one angle: ~1.5x the cost of a single sin where the libc
+// exposes sincos (glibc, musl, emscripten) or __sincos (Darwin), instead of
+// two full argument reductions. MSVC falls back to separate calls.
+// Small-power shortcuts: plain multiplies and sqrts beat a general pow call
+// by a wide margin and vectorize trivially. Done at source level since the
+// build doesn't enable -ffast-math for libm strength reduction.
+static inline double Pow3(double x) {
+    return x * x * x;
+}
+static inline double Pow4(double x) {
+    double x2 = x * x;
+    return x2 * x2;
+}
+// pow(x, 0.25) for x >= 0
+// x^k for a constant non-integer exponent via exp2(k*log2(x)). log2+exp2
+// skip libm's general-base pow path and both have vector forms in libmvec.
+// Matches pow for the inputs used here: x > 0 normally, 0 -> 0 for k > 0,
+// and negative x -> NaN either way.
+static inline double PowConst(double x, double k) {
+    return exp2(k * log2(x));
+}
+
+static inline double QuarticRoot(double x) {
+    return sqrt(sqrt(x));
+}
+
+// a*b + c as a single fused operation where the target has hardware FMA
+// (one rounding, half the latency of mul+add). Elsewhere the plain
+// expression is kept: a libm fma() soft fallback would be far slower, and
+// -ffp-contract may still fuse it.
+static inline double MulAdd(double a, double b, double c) {
+#if defined(__FMA__) || defined(__aarch64__)
+    return fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+// Software prefetch for the transcendental-heavy batch loops: the libm
+// call latency gives the hint time to land, hiding a miss when a column
+// is not yet cache-resident. A hint never faults, so running a few lines
+// past the end of the buffer is fine; no-op where the builtin is missing.
+#if defined(__GNUC__) || defined(__clang__)
+#define ASTRO_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define ASTRO_PREFETCH(addr) ((void)0)
+#endif
+
+// `omp simd` annotation for the independent batch loops: when the build
+// enables -fopenmp-simd (see CMakeLists.txt, no OpenMP runtime involved)
+// it asserts the absence of cross-iteration dependencies so the compiler
+// vectorizes without having to prove it. Deliberately `simd` only -
+// threading stays DuckDB's own morsel-driven parallelism.
+#if defined(ASTRO_OPENMP_SIMD)
+#define ASTRO_SIMD_LOOP _Pragma("omp simd")
+#else
+#define ASTRO_SIMD_LOOP
+#endif
+
+static inline void SinCos(double x, double &s, double &c) {
+#if defined(__APPLE__)
+    __sincos(x, &s, &c);
+#elif defined(__GNUC__)
+    __builtin_sincos(x, &s, &c);
+#else
+    s = sin(x);
+    c = cos(x);
+#endif
+}
 
 // 3x3 rotation matrix
 struct Mat3 {
@@ -154,22 +231,40 @@ struct Mat3 {
     }
 };
 
-// ICRS <-> Galactic rotation matrix
-static Mat3 GetICRSToGalacticMatrix() {
-    // Precomputed rotation matrix from ICRS to Galactic coordinates
-    // Based on IAU 1958 definition with J2000 pole
-    static Mat3 mat = {{
-        -0.0548755604162154, -0.8734370902348850, -0.4838350155487132,
-        +0.4941094278755837, -0.4448296299600112, +0.7469822444972812,
-        -0.8676661490190047, -0.1980763734312015, +0.4559837761750669
-    }};
-    return mat;
+// Apply one rotation to SoA column data. The nine matrix entries are
+// loop-invariant broadcasts and each output is a 3-term mul/add chain
+// over contiguous loads, which compilers turn into packed FMAs.
+static void Mat3ApplyBatch(const Mat3 &mat, const double *x_in, const double *y_in, const double *z_in,
+                           double *x_out, double *y_out, double *z_out, idx_t count) {
+    const double m00 = mat.m[0], m01 = mat.m[1], m02 = mat.m[2];
+    const double m10 = mat.m[3], m11 = mat.m[4], m12 = mat.m[5];
+    const double m20 = mat.m[6], m21 = mat.m[7], m22 = mat.m[8];
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        double x = x_in[i], y = y_in[i], z = z_in[i];
+        x_out[i] = m00 * x + m01 * y + m02 * z;
+        y_out[i] = m10 * x + m11 * y + m12 * z;
+        z_out[i] = m20 * x + m21 * y + m22 * z;
+    }
 }
 
+// ICRS <-> Galactic rotation matrices, built once at extension load so
+// per-chunk calls neither copy nor re-transpose them.
+// Precomputed rotation from ICRS to Galactic coordinates, based on the
+// IAU 1958 definition with J2000 pole.
+static const Mat3 ICRS_TO_GAL = {{
+    -0.0548755604162154, -0.8734370902348850, -0.4838350155487132,
+    +0.4941094278755837, -0.4448296299600112, +0.7469822444972812,
+    -0.8676661490190047, -0.1980763734312015, +0.4559837761750669
+}};
+static const Mat3 GAL_TO_ICRS = ICRS_TO_GAL.transpose();
+
 // Spherical to Cartesian (unit sphere)
 static Vec3 SphericalToCartesian(double lon_rad, double lat_rad) {
-    double cos_lat = cos(lat_rad);
-    return {cos_lat * cos(lon_rad), cos_lat * sin(lon_rad), sin(lat_rad)};
+    double slon, clon, slat, clat;
+    SinCos(lon_rad, slon, clon);
+    SinCos(lat_rad, slat, clat);
+    return {clat * clon, clat * slon, slat};
 }
 
 // Cartesian to Spherical
@@ -179,20 +274,35 @@ static void CartesianToSpherical(const Vec3 &v, double &lon_rad, double &lat_rad
     if (lon_rad < 0) lon_rad += 2.0 * M_PI;
 }
 
-// Kepler equation solver (Newton-Raphson)
+// Kepler equation solver (Danby's third-order method). Converges in 2-4
+// iterations for e < 0.9 versus up to 50 Newton-Raphson steps, with one
+// sin/cos pair per iteration instead of one per correction order.
 static double SolveKeplerEquation(double M, double e) {
-    double E = M;
-    for (int i = 0; i < 50; i++) {
-        double delta = (E - e * sin(E) - M) / (1.0 - e * cos(E));
-        E -= delta;
-        if (std::abs(delta) < 1e-12) break;
+    if (e < 1e-8) {
+        return M;  // effectively circular
+    }
+    double E = M + e * sin(M);
+    for (int k = 0; k < 8; k++) {
+        double s, c;
+        SinCos(E, s, c);
+        double f = E - e * s - M;
+        double fp = 1.0 - e * c;
+        double fpp = e * s;
+        double fppp = e * c;
+        double d1 = -f / fp;
+        double d2 = -f / (fp + 0.5 * d1 * fpp);
+        double d3 = -f / (fp + 0.5 * d2 * fpp + (d2 * d2 / 6.0) * fppp);
+        E += d3;
+        if (std::abs(d3) < 1e-13) break;
     }
     return E;
 }
 
 // True anomaly from eccentric anomaly
 static double TrueAnomalyFromEccentric(double E, double e) {
-    return 2.0 * atan2(sqrt(1.0 + e) * sin(E / 2.0), sqrt(1.0 - e) * cos(E / 2.0));
+    double sE2, cE2;
+    SinCos(E / 2.0, sE2, cE2);
+    return 2.0 * atan2(sqrt(1.0 + e) * sE2, sqrt(1.0 - e) * cE2);
 }
 
 // Compute orbital state (position and velocity) from Keplerian elements
@@ -201,62 +311,196 @@ struct OrbitalState {
     Vec3 vel;
 };
 
-static OrbitalState ComputeOrbitalState(double a, double e, double i, double omega,
-                                         double w, double M0, double epoch_jd,
-                                         double central_mass, double t_jd) {
-    // Mean motion
-    double n = sqrt(CONST_G * central_mass / (a * a * a));
+// Rotation from the orbital plane into the reference frame (3-1-3: Omega,
+// i, w). Depends only on the orbital elements, so it can be built once per
+// orbit and reused across evaluation times.
+struct OrbitFrame {
+    double r11, r12, r21, r22, r31, r32;
+};
 
-    // Mean anomaly at time t
-    double dt_s = (t_jd - epoch_jd) * JULIAN_DAY_SECONDS;
-    double M = fmod(M0 + n * dt_s, 2.0 * M_PI);
-    if (M < 0) M += 2.0 * M_PI;
+static OrbitFrame BuildOrbitFrame(double i, double omega, double w) {
+    double sO, cO, si, ci, sw, cw;
+    SinCos(omega, sO, cO);
+    SinCos(i, si, ci);
+    SinCos(w, sw, cw);
+
+    OrbitFrame f;
+    f.r11 = cO * cw - sO * sw * ci;
+    f.r12 = -cO * sw - sO * cw * ci;
+    f.r21 = sO * cw + cO * sw * ci;
+    f.r22 = -sO * sw + cO * cw * ci;
+    f.r31 = sw * si;
+    f.r32 = cw * si;
+    return f;
+}
 
-    // Solve Kepler's equation
-    double E = SolveKeplerEquation(M, e);
+// Mean motion for a given semi-major axis and central mass
+static double OrbitMeanMotionRad(double a, double central_mass) {
+    return sqrt(CONST_G * central_mass / (a * a * a));
+}
+
+// Lockstep Kepler solve over a block of mean anomalies for one orbit.
+// Every lane runs the same fixed number of third-order corrections, so
+// the inner loops are straight-line trig the vectorizer can batch; the
+// few redundant corrections on early-converging lanes are cheaper than
+// per-lane convergence branches. Four Danby steps exceed the tolerance
+// the scalar solver iterates to for any e < 0.9.
+constexpr idx_t KEPLER_BLOCK = 256;
+
+static void SolveKeplerBlock(const double *M, double e, double *E, idx_t count) {
+    if (e < 1e-8) {
+        memcpy(E, M, count * sizeof(double));  // effectively circular
+        return;
+    }
+    for (idx_t i = 0; i < count; i++) {
+        E[i] = M[i] + e * sin(M[i]);
+    }
+    for (int k = 0; k < 4; k++) {
+        for (idx_t i = 0; i < count; i++) {
+            double s, c;
+            SinCos(E[i], s, c);
+            double f = E[i] - e * s - M[i];
+            double fp = 1.0 - e * c;
+            double fpp = e * s;
+            double fppp = e * c;
+            double d1 = -f / fp;
+            double d2 = -f / (fp + 0.5 * d1 * fpp);
+            double d3 = -f / (fp + 0.5 * d2 * fpp + (d2 * d2 / 6.0) * fppp);
+            E[i] += d3;
+        }
+    }
+}
+
+// In-plane geometry and rotation for an already-solved eccentric anomaly
+static OrbitalState OrbitalStateFromEccentric(const OrbitFrame &f, double a, double e,
+                                              double central_mass, double E) {
     double nu = TrueAnomalyFromEccentric(E, e);
 
-    // Distance and position in orbital plane
+    // Distance and position in orbital plane; one sin/cos pair of nu
+    // serves both position and velocity
+    double snu, cnu;
+    SinCos(nu, snu, cnu);
     double r = a * (1.0 - e * cos(E));
-    double x_orb = r * cos(nu);
-    double y_orb = r * sin(nu);
+    double x_orb = r * cnu;
+    double y_orb = r * snu;
 
     // Velocity in orbital plane
     double h = sqrt(CONST_G * central_mass * a * (1.0 - e * e));
-    double vx_orb = -h / r * sin(nu);
-    double vy_orb = h / r * (e + cos(nu));
-
-    // Rotation matrix elements
-    double cO = cos(omega), sO = sin(omega);
-    double ci = cos(i), si = sin(i);
-    double cw = cos(w), sw = sin(w);
-
-    // Combined rotation matrix (3-1-3: Omega, i, w)
-    double r11 = cO * cw - sO * sw * ci;
-    double r12 = -cO * sw - sO * cw * ci;
-    double r21 = sO * cw + cO * sw * ci;
-    double r22 = -sO * sw + cO * cw * ci;
-    double r31 = sw * si;
-    double r32 = cw * si;
+    double vx_orb = -h / r * snu;
+    double vy_orb = h / r * (e + cnu);
 
     OrbitalState state;
-    state.pos = {r11 * x_orb + r12 * y_orb, r21 * x_orb + r22 * y_orb, r31 * x_orb + r32 * y_orb};
-    state.vel = {r11 * vx_orb + r12 * vy_orb, r21 * vx_orb + r22 * vy_orb, r31 * vx_orb + r32 * vy_orb};
+    state.pos = {f.r11 * x_orb + f.r12 * y_orb, f.r21 * x_orb + f.r22 * y_orb, f.r31 * x_orb + f.r32 * y_orb};
+    state.vel = {f.r11 * vx_orb + f.r12 * vy_orb, f.r21 * vx_orb + f.r22 * vy_orb, f.r31 * vx_orb + f.r32 * vy_orb};
     return state;
 }
 
-// Sector size helper
+// Mean anomaly at time t, wrapped into [0, 2*pi)
+static inline double MeanAnomalyAt(double M0, double epoch_jd, double n, double t_jd) {
+    double dt_s = (t_jd - epoch_jd) * JULIAN_DAY_SECONDS;
+    double M = fmod(M0 + n * dt_s, 2.0 * M_PI);
+    return M < 0 ? M + 2.0 * M_PI : M;
+}
+
+// Advance the orbit to time t_jd with a prebuilt rotation frame and mean
+// motion; only the per-time part (Kepler solve + in-plane geometry) remains.
+static OrbitalState ComputeOrbitalStateInFrame(const OrbitFrame &f, double a, double e,
+                                               double M0, double epoch_jd,
+                                               double central_mass, double n, double t_jd) {
+    double M = MeanAnomalyAt(M0, epoch_jd, n, t_jd);
+    double E = SolveKeplerEquation(M, e);
+    return OrbitalStateFromEccentric(f, a, e, central_mass, E);
+}
+
+static OrbitalState ComputeOrbitalState(double a, double e, double i, double omega,
+                                         double w, double M0, double epoch_jd,
+                                         double central_mass, double t_jd) {
+    return ComputeOrbitalStateInFrame(BuildOrbitFrame(i, omega, w), a, e, M0, epoch_jd,
+                                      central_mass, OrbitMeanMotionRad(a, central_mass), t_jd);
+}
+
+// Precomputed sector edge lengths for all 64 levels: the per-call shift,
+// int-to-double convert and divide become a single table load.
+struct SectorSizeTable {
+    double size[64];
+    SectorSizeTable() {
+        for (int i = 0; i < 64; i++) {
+            size[i] = SECTOR_BASE_SIZE_M / static_cast<double>(1ULL << i);
+        }
+    }
+};
+static const SectorSizeTable SECTOR_SIZES;
+
+// Callers validate 0 <= level < 64 before the lookup: astro_sector_id as
+// the level argument comes in, astro_sector_center/_bounds in their size
+// pre-pass (sector structs are user-constructible, so their level column
+// cannot be trusted either)
 static double GetSectorSize(int32_t level) {
-    return SECTOR_BASE_SIZE_M / static_cast<double>(1LL << level);
+    return SECTOR_SIZES.size[level];
+}
+
+// ============================================================================
+// BATCH KERNEL HELPERS
+// ============================================================================
+// True when a vector can be read through its raw flat data pointer with no
+// NULLs - the common case the batched kernels below rely on.
+static inline bool IsFlatNoNulls(Vector &v) {
+    return v.GetVectorType() == VectorType::FLAT_VECTOR && FlatVector::Validity(v).AllValid();
+}
+
+// Flat child pointers of a position/velocity STRUCT: the three components
+// plus the frame child (kept as a Vector* for string handling). Resolved
+// once per chunk so kernels index plain arrays instead of re-walking
+// StructVector::GetEntries per field or - worse - per row.
+struct XyzPtrs {
+    double *x;
+    double *y;
+    double *z;
+    Vector *frame;
+};
+
+static inline XyzPtrs GetXyzPtrs(Vector &v) {
+    auto &children = StructVector::GetEntries(v);
+    XyzPtrs ptrs;
+    ptrs.x = FlatVector::GetData<double>(*children[0]);
+    ptrs.y = FlatVector::GetData<double>(*children[1]);
+    ptrs.z = FlatVector::GetData<double>(*children[2]);
+    ptrs.frame = children[3].get();
+    return ptrs;
+}
+
+// Shared dispatch for (double, double) -> double functions with a
+// contiguous batch kernel: flat no-null inputs run the kernel over the
+// raw pointers for the whole chunk, everything else takes the row-wise
+// executor with the scalar lambda. Keeps the fast/slow split in one
+// place instead of repeated per function.
+template <void (*KERNEL)(const double *, const double *, double *, idx_t), class FUNC>
+static inline void BinaryBatchDispatch(DataChunk &args, Vector &result, FUNC fallback) {
+    if (IsFlatNoNulls(args.data[0]) && IsFlatNoNulls(args.data[1])) {
+        result.SetVectorType(VectorType::FLAT_VECTOR);
+        KERNEL(FlatVector::GetData<double>(args.data[0]),
+               FlatVector::GetData<double>(args.data[1]),
+               FlatVector::GetData<double>(result), args.size());
+        return;
+    }
+    BinaryExecutor::Execute<double, double, double>(
+        args.data[0], args.data[1], result, args.size(), fallback);
 }
 
 // ============================================================================
 // CONSTANT FUNCTIONS
 // ============================================================================
-#define DEFINE_CONST_FUNC(Name, Value) \
+// Besides the executor (kept for completeness), each constant function gets
+// a bind_expression hook that replaces the call with its literal during
+// binding, so expressions like astro_const_c() * 2 fold at plan time and
+// never enter a vector loop.
+#define DEFINE_CONST_FUNC(Name, Constant) \
 static void AstroConst##Name(DataChunk &args, ExpressionState &state, Vector &result) { \
     result.SetVectorType(VectorType::CONSTANT_VECTOR); \
-    ConstantVector::GetData<double>(result)[0] = Value; \
+    ConstantVector::GetData<double>(result)[0] = Constant; \
+} \
+static unique_ptr<Expression> AstroConst##Name##Expr(FunctionBindExpressionInput &input) { \
+    return make_uniq<BoundConstantExpression>(Value::DOUBLE(Constant)); \
 }
 
 DEFINE_CONST_FUNC(C, CONST_C)
@@ -276,47 +520,136 @@ DEFINE_CONST_FUNC(SigmaSB, CONST_SIGMA_SB)
 // ============================================================================
 // UNIT CONVERSION FUNCTIONS
 // ============================================================================
-static void AstroUnitLengthToM(DataChunk &args, ExpressionState &state, Vector &result) {
+// Pack an ASCII unit token (max 8 chars) into a lowercased uint64 key, so
+// unit lookup is one integer switch instead of a per-row std::string
+// allocation plus a compare chain. Recursive form keeps it a C++11
+// constant expression usable as a case label. Byte order matches the
+// little-endian memcpy in UnitKey (all release targets are little-endian).
+static constexpr uint64_t PackUnitKey(const char *s, int i = 0) {
+    return (i >= 8 || s[i] == '\0')
+               ? 0
+               : ((static_cast<uint64_t>(static_cast<uint8_t>(s[i]) | 0x20) << (8 * i)) | PackUnitKey(s, i + 1));
+}
+
+// ASCII-lowercase the token in-register with a masked OR. Tokens longer
+// than 8 bytes cannot match any key and fall through to the error case.
+static inline uint64_t UnitKey(string_t unit_str) {
+    idx_t len = unit_str.GetSize();
+    if (len == 0 || len > 8) {
+        return ~uint64_t(0);
+    }
+    uint64_t w = 0;
+    memcpy(&w, unit_str.GetData(), len);
+    uint64_t mask = len == 8 ? ~uint64_t(0) : ((uint64_t(1) << (8 * len)) - 1);
+    return w | (0x2020202020202020ULL & mask);
+}
+
+static double ResolveLengthFactor(string_t unit_str) {
+    switch (UnitKey(unit_str)) {
+    case PackUnitKey("m"): return 1.0;
+    case PackUnitKey("km"): return 1000.0;
+    case PackUnitKey("au"): return CONST_AU;
+    case PackUnitKey("ly"): return CONST_LY;
+    case PackUnitKey("pc"): return CONST_PC;
+    default:
+        throw InvalidInputException("Unknown length unit: '%s'. Valid: m, km, AU, ly, pc",
+                                    unit_str.GetString().c_str());
+    }
+}
+
+static double ResolveMassFactor(string_t unit_str) {
+    switch (UnitKey(unit_str)) {
+    case PackUnitKey("kg"): return 1.0;
+    case PackUnitKey("m_sun"):
+    case PackUnitKey("msun"): return CONST_M_SUN;
+    case PackUnitKey("m_earth"):
+    case PackUnitKey("mearth"): return CONST_M_EARTH;
+    case PackUnitKey("mjup"): return CONST_M_JUPITER;
+    default:
+        // "m_jupiter" is 9 chars and exceeds the packed-key width
+        if (StringUtil::Lower(unit_str.GetString()) == "m_jupiter") return CONST_M_JUPITER;
+        throw InvalidInputException("Unknown mass unit: '%s'. Valid: kg, M_sun, M_earth, M_jupiter",
+                                    unit_str.GetString().c_str());
+    }
+}
+
+static double ResolveTimeFactor(string_t unit_str) {
+    switch (UnitKey(unit_str)) {
+    case PackUnitKey("s"): return 1.0;
+    case PackUnitKey("min"): return 60.0;
+    case PackUnitKey("h"): return 3600.0;
+    case PackUnitKey("d"): return 86400.0;
+    case PackUnitKey("yr"): return 31557600.0;  // Julian year
+    case PackUnitKey("myr"): return 31557600.0e6;
+    case PackUnitKey("gyr"): return 31557600.0e9;
+    default:
+        throw InvalidInputException("Unknown time unit: '%s'. Valid: s, min, h, d, yr, Myr, Gyr",
+                                    unit_str.GetString().c_str());
+    }
+}
+
+// Bind data holding a unit factor resolved from a foldable literal at
+// plan time, so execution never touches the unit string at all.
+struct UnitBindData : public FunctionData {
+    explicit UnitBindData(double factor_p) : factor(factor_p) {
+    }
+    double factor;
+
+    unique_ptr<FunctionData> Copy() const override {
+        return make_uniq<UnitBindData>(factor);
+    }
+    bool Equals(const FunctionData &other) const override {
+        return factor == other.Cast<UnitBindData>().factor;
+    }
+};
+
+template <double (*RESOLVE)(string_t)>
+static unique_ptr<FunctionData> UnitBind(ClientContext &context, ScalarFunction &bound_function,
+                                         vector<unique_ptr<Expression>> &arguments) {
+    if (!arguments[1]->IsFoldable()) {
+        return nullptr;
+    }
+    Value unit = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+    if (unit.IsNull()) {
+        return nullptr;
+    }
+    auto &unit_str = StringValue::Get(unit);
+    return make_uniq<UnitBindData>(RESOLVE(string_t(unit_str.c_str(), uint32_t(unit_str.size()))));
+}
+
+// Shared driver: a literal unit is resolved once at bind time; a constant
+// unit vector once per chunk. Either way the row loop is one multiply.
+template <double (*RESOLVE)(string_t)>
+static void UnitConvert(DataChunk &args, ExpressionState &state, Vector &result) {
+    auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+    if (func_expr.bind_info) {
+        double factor = func_expr.bind_info->Cast<UnitBindData>().factor;
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [factor](double value) { return value * factor; });
+        return;
+    }
+    auto &unit_vec = args.data[1];
+    if (unit_vec.GetVectorType() == VectorType::CONSTANT_VECTOR && !ConstantVector::IsNull(unit_vec)) {
+        double factor = RESOLVE(ConstantVector::GetData<string_t>(unit_vec)[0]);
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [factor](double value) { return value * factor; });
+        return;
+    }
     BinaryExecutor::Execute<double, string_t, double>(
         args.data[0], args.data[1], result, args.size(),
-        [](double value, string_t unit_str) {
-            string unit = StringUtil::Lower(unit_str.GetString());
-            if (unit == "m") return value;
-            if (unit == "km") return value * 1000.0;
-            if (unit == "au") return value * CONST_AU;
-            if (unit == "ly") return value * CONST_LY;
-            if (unit == "pc") return value * CONST_PC;
-            throw InvalidInputException("Unknown length unit: '%s'. Valid: m, km, AU, ly, pc", unit.c_str());
-        });
+        [](double value, string_t unit_str) { return value * RESOLVE(unit_str); });
+}
+
+static void AstroUnitLengthToM(DataChunk &args, ExpressionState &state, Vector &result) {
+    UnitConvert<ResolveLengthFactor>(args, state, result);
 }
 
 static void AstroUnitMassToKg(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, string_t, double>(
-        args.data[0], args.data[1], result, args.size(),
-        [](double value, string_t unit_str) {
-            string unit = StringUtil::Lower(unit_str.GetString());
-            if (unit == "kg") return value;
-            if (unit == "m_sun" || unit == "msun") return value * CONST_M_SUN;
-            if (unit == "m_earth" || unit == "mearth") return value * CONST_M_EARTH;
-            if (unit == "m_jupiter" || unit == "mjup") return value * CONST_M_JUPITER;
-            throw InvalidInputException("Unknown mass unit: '%s'. Valid: kg, M_sun, M_earth, M_jupiter", unit.c_str());
-        });
+    UnitConvert<ResolveMassFactor>(args, state, result);
 }
 
 static void AstroUnitTimeToS(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, string_t, double>(
-        args.data[0], args.data[1], result, args.size(),
-        [](double value, string_t unit_str) {
-            string unit = StringUtil::Lower(unit_str.GetString());
-            if (unit == "s") return value;
-            if (unit == "min") return value * 60.0;
-            if (unit == "h") return value * 3600.0;
-            if (unit == "d") return value * 86400.0;
-            if (unit == "yr") return value * 31557600.0;  // Julian year
-            if (unit == "myr") return value * 31557600.0e6;
-            if (unit == "gyr") return value * 31557600.0e9;
-            throw InvalidInputException("Unknown time unit: '%s'. Valid: s, min, h, d, yr, Myr, Gyr", unit.c_str());
-        });
+    UnitConvert<ResolveTimeFactor>(args, state, result);
 }
 
 // Unit shortcuts
@@ -346,115 +679,245 @@ struct BodyProperties {
     const char *body_type;
 };
 
-static void WriteBodyToResult(Vector &result, idx_t row, const BodyProperties &props) {
-    auto &children = StructVector::GetEntries(result);
-    FlatVector::GetData<double>(*children[0])[row] = props.mass_kg;
-    FlatVector::GetData<double>(*children[1])[row] = props.radius_m;
-    FlatVector::GetData<double>(*children[2])[row] = props.luminosity_w;
-    FlatVector::GetData<double>(*children[3])[row] = props.temperature_k;
-    FlatVector::GetData<double>(*children[4])[row] = props.density_kg_m3;
-    FlatVector::GetData<string_t>(*children[5])[row] = StringVector::AddString(*children[5], props.body_type);
+// Resolves the six SoA child arrays of a body STRUCT result once per chunk;
+// the row loops then store straight through flat pointers instead of
+// re-walking the child-vector list on every row.
+struct BodyVectorWriter {
+    double *mass, *radius, *luminosity, *temperature, *density;
+    string_t *type;
+    Vector *type_vec;
+
+    explicit BodyVectorWriter(Vector &result) {
+        auto &children = StructVector::GetEntries(result);
+        mass = FlatVector::GetData<double>(*children[0]);
+        radius = FlatVector::GetData<double>(*children[1]);
+        luminosity = FlatVector::GetData<double>(*children[2]);
+        temperature = FlatVector::GetData<double>(*children[3]);
+        density = FlatVector::GetData<double>(*children[4]);
+        type = FlatVector::GetData<string_t>(*children[5]);
+        type_vec = children[5].get();
+    }
+
+    void Write(idx_t row, const BodyProperties &props) {
+        mass[row] = props.mass_kg;
+        radius[row] = props.radius_m;
+        luminosity[row] = props.luminosity_w;
+        temperature[row] = props.temperature_k;
+        density[row] = props.density_kg_m3;
+        // Each body function writes one fixed literal; allocate it in the
+        // string heap once and reuse the string_t handle for every row
+        if (props.body_type != cached_literal) {
+            cached_literal = props.body_type;
+            cached_type = StringVector::AddString(*type_vec, props.body_type);
+        }
+        type[row] = cached_type;
+    }
+
+private:
+    const char *cached_literal = nullptr;
+    string_t cached_type;
+};
+
+// Sphere volume factors, folded at compile time so density is a
+// mul + div over r^3 instead of a four-op constant chain per row
+constexpr double FOUR_THIRD_PI = 4.0 * M_PI / 3.0;
+constexpr double INV_FOUR_THIRD_PI = 3.0 / (4.0 * M_PI);
+
+// Stefan-Boltzmann luminosity prefactor: L = 4*pi*sigma * R^2 * T^4
+constexpr double FOUR_PI_SIGMA = 4.0 * M_PI * CONST_SIGMA_SB;
+
+static inline double ComputeDensity(double mass_kg, double radius_m) {
+    return mass_kg * INV_FOUR_THIRD_PI / Pow3(radius_m);
 }
 
-static double ComputeDensity(double mass_kg, double radius_m) {
-    double volume = (4.0 / 3.0) * M_PI * radius_m * radius_m * radius_m;
-    return mass_kg / volume;
+static inline BodyProperties StarMsBody(double mass_msun) {
+    // Main-sequence relations (simplified but physically motivated)
+    double L_lsun = Pow3(mass_msun) * sqrt(mass_msun);  // mass^3.5 without pow
+    double R_rsun = PowConst(mass_msun, 0.8);
+    double L_w = L_lsun * CONST_L_SUN;
+    double R_m = R_rsun * CONST_R_SUN;
+    double T_k = QuarticRoot(L_w / (FOUR_PI_SIGMA * R_m * R_m));
+    double M_kg = mass_msun * CONST_M_SUN;
+    return {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "star_main_sequence"};
 }
 
 static void AstroBodyMakeStarMs(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        // Constant mass: evaluate the relations once and broadcast the struct
+        if (ConstantVector::IsNull(args.data[0])) {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(result, true);
+            return;
+        }
+        BodyVectorWriter writer(result);
+        writer.Write(0, StarMsBody(ConstantVector::GetData<double>(args.data[0])[0]));
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        return;
+    }
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        // Contiguous mass loads: compilers with a vector math library
+        // (libmvec/SLEEF) can batch the pow chain across rows here
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, StarMsBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_msun = mass_ptr[input.sel->get_index(i)];
-
-        // Main-sequence relations (simplified but physically motivated)
-        double L_lsun = pow(mass_msun, 3.5);
-        double R_rsun = pow(mass_msun, 0.8);
-        double L_w = L_lsun * CONST_L_SUN;
-        double R_m = R_rsun * CONST_R_SUN;
-        double T_k = pow(L_w / (4.0 * M_PI * R_m * R_m * CONST_SIGMA_SB), 0.25);
-        double M_kg = mass_msun * CONST_M_SUN;
-
-        WriteBodyToResult(result, i, {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "star_main_sequence"});
+        writer.Write(i, StarMsBody(mass_ptr[input.sel->get_index(i)]));
     }
 }
 
+static inline BodyProperties PlanetRockyBody(double mass_mearth) {
+    // Chen & Kipping 2017 mass-radius relation for rocky planets.
+    // Both regimes are evaluated and selected: a data-dependent branch on
+    // mass mispredicts on mixed catalogs and blocks vectorization.
+    double r_lo = PowConst(mass_mearth, 0.27);
+    double r_hi = PowConst(mass_mearth, 0.55);
+    double R_rearth = mass_mearth < 1.0 ? r_lo : r_hi;
+    double M_kg = mass_mearth * CONST_M_EARTH;
+    double R_m = R_rearth * CONST_R_EARTH;
+    return {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_rocky"};
+}
+
 static void AstroBodyMakePlanetRocky(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        if (ConstantVector::IsNull(args.data[0])) {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(result, true);
+            return;
+        }
+        BodyVectorWriter writer(result);
+        writer.Write(0, PlanetRockyBody(ConstantVector::GetData<double>(args.data[0])[0]));
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        return;
+    }
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, PlanetRockyBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_mearth = mass_ptr[input.sel->get_index(i)];
-
-        // Chen & Kipping 2017 mass-radius relation for rocky planets
-        double R_rearth = mass_mearth < 1.0 ? pow(mass_mearth, 0.27) : pow(mass_mearth, 0.55);
-        double M_kg = mass_mearth * CONST_M_EARTH;
-        double R_m = R_rearth * CONST_R_EARTH;
-
-        WriteBodyToResult(result, i, {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_rocky"});
+        writer.Write(i, PlanetRockyBody(mass_ptr[input.sel->get_index(i)]));
     }
 }
 
+static inline BodyProperties PlanetGasGiantBody(double mass_mjup) {
+    // Gas giants have roughly constant radius (degeneracy pressure).
+    // Branchless select over both regimes, as for rocky planets.
+    double r_lo = PowConst(mass_mjup / 0.3, 0.6);
+    double r_hi = PowConst(mass_mjup, -0.04);
+    double R_rjup = mass_mjup < 0.3 ? r_lo : r_hi;
+    double M_kg = mass_mjup * CONST_M_JUPITER;
+    double R_m = R_rjup * CONST_R_JUPITER;
+    return {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_gas_giant"};
+}
+
 static void AstroBodyMakePlanetGasGiant(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        if (ConstantVector::IsNull(args.data[0])) {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(result, true);
+            return;
+        }
+        BodyVectorWriter writer(result);
+        writer.Write(0, PlanetGasGiantBody(ConstantVector::GetData<double>(args.data[0])[0]));
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        return;
+    }
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, PlanetGasGiantBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_mjup = mass_ptr[input.sel->get_index(i)];
+        writer.Write(i, PlanetGasGiantBody(mass_ptr[input.sel->get_index(i)]));
+    }
+}
 
-        // Gas giants have roughly constant radius (degeneracy pressure)
-        double R_rjup = mass_mjup < 0.3 ? pow(mass_mjup / 0.3, 0.6) : pow(mass_mjup, -0.04);
-        double M_kg = mass_mjup * CONST_M_JUPITER;
-        double R_m = R_rjup * CONST_R_JUPITER;
+// Neptune mass/radius for ice giant scaling
+constexpr double M_NEPTUNE = 1.024e26;  // kg
+constexpr double R_NEPTUNE = 2.4622e7;  // m
 
-        WriteBodyToResult(result, i, {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_gas_giant"});
-    }
+static inline BodyProperties PlanetIceGiantBody(double mass_mnep) {
+    // Ice giant mass-radius relation (Neptune-like, higher density than gas giants)
+    double R_rnep = PowConst(mass_mnep, 0.55);
+    double M_kg = mass_mnep * M_NEPTUNE;
+    double R_m = R_rnep * R_NEPTUNE;
+    return {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_ice_giant"};
 }
 
 static void AstroBodyMakePlanetIceGiant(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        if (ConstantVector::IsNull(args.data[0])) {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(result, true);
+            return;
+        }
+        BodyVectorWriter writer(result);
+        writer.Write(0, PlanetIceGiantBody(ConstantVector::GetData<double>(args.data[0])[0]));
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        return;
+    }
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
-    // Neptune mass/radius for scaling
-    constexpr double M_NEPTUNE = 1.024e26;  // kg
-    constexpr double R_NEPTUNE = 2.4622e7;  // m
-
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, PlanetIceGiantBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_mnep = mass_ptr[input.sel->get_index(i)];
-
-        // Ice giant mass-radius relation (Neptune-like, higher density than gas giants)
-        double R_rnep = pow(mass_mnep, 0.55);
-        double M_kg = mass_mnep * M_NEPTUNE;
-        double R_m = R_rnep * R_NEPTUNE;
-
-        WriteBodyToResult(result, i, {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "planet_ice_giant"});
+        writer.Write(i, PlanetIceGiantBody(mass_ptr[input.sel->get_index(i)]));
     }
 }
 
+static inline BodyProperties StarWhiteDwarfBody(double mass_msun) {
+    // White dwarf: Mass-radius relation (Chandrasekhar) - radius decreases with mass
+    // R ∝ M^(-1/3) normalized to ~0.01 R_sun at 0.6 M_sun
+    double R_rsun = 0.01 * cbrt(0.6 / mass_msun);
+    double M_kg = mass_msun * CONST_M_SUN;
+    double R_m = R_rsun * CONST_R_SUN;
+
+    // Luminosity from cooling curve approximation (L ∝ T^4, typical T ~ 10000-20000 K)
+    double T_k = 15000.0 * PowConst(mass_msun / 0.6, 0.1);  // simplified
+    double L_w = FOUR_PI_SIGMA * R_m * R_m * Pow4(T_k);
+    return {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "star_white_dwarf"};
+}
+
 static void AstroBodyMakeStarWhiteDwarf(DataChunk &args, ExpressionState &state, Vector &result) {
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, StarWhiteDwarfBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_msun = mass_ptr[input.sel->get_index(i)];
-
-        // White dwarf: Mass-radius relation (Chandrasekhar) - radius decreases with mass
-        // R ∝ M^(-1/3) normalized to ~0.01 R_sun at 0.6 M_sun
-        double R_rsun = 0.01 * pow(0.6 / mass_msun, 1.0/3.0);
-        double M_kg = mass_msun * CONST_M_SUN;
-        double R_m = R_rsun * CONST_R_SUN;
-
-        // Luminosity from cooling curve approximation (L ∝ T^4, typical T ~ 10000-20000 K)
-        double T_k = 15000.0 * pow(mass_msun / 0.6, 0.1);  // simplified
-        double L_w = 4.0 * M_PI * R_m * R_m * CONST_SIGMA_SB * pow(T_k, 4);
-
-        WriteBodyToResult(result, i, {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "star_white_dwarf"});
+        writer.Write(i, StarWhiteDwarfBody(mass_ptr[input.sel->get_index(i)]));
     }
 }
 
@@ -462,77 +925,126 @@ static void AstroBodyMakeStarNeutron(DataChunk &args, ExpressionState &state, Ve
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
-    for (idx_t i = 0; i < args.size(); i++) {
-        double mass_msun = mass_ptr[input.sel->get_index(i)];
+    // Neutron star: ~10-12 km radius and ~1e6 K surface temperature,
+    // both model constants — radius, temperature and luminosity are
+    // row-invariant, so only mass and density vary inside the loop
+    const double R_m = 1.1e4;  // ~11 km typical radius
+    const double T_k = 1.0e6;  // young neutron stars are hot
+    const double L_w = FOUR_PI_SIGMA * R_m * R_m * Pow4(T_k);
+    const double inv_volume = INV_FOUR_THIRD_PI / Pow3(R_m);
 
-        // Neutron star: ~10-12 km radius, roughly constant
-        double R_m = 1.1e4;  // ~11 km typical radius
-        double M_kg = mass_msun * CONST_M_SUN;
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            double M_kg = mass_ptr[i] * CONST_M_SUN;
+            writer.Write(i, {M_kg, R_m, L_w, T_k, M_kg * inv_volume, "star_neutron"});
+        }
+        return;
+    }
+    for (idx_t i = 0; i < args.size(); i++) {
+        double M_kg = mass_ptr[input.sel->get_index(i)] * CONST_M_SUN;
+        writer.Write(i, {M_kg, R_m, L_w, T_k, M_kg * inv_volume, "star_neutron"});
+    }
+}
 
-        // Young neutron stars are hot; simplify to ~1e6 K
-        double T_k = 1.0e6;
-        double L_w = 4.0 * M_PI * R_m * R_m * CONST_SIGMA_SB * pow(T_k, 4);
+static inline BodyProperties BrownDwarfBody(double mass_mjup) {
+    // Brown dwarfs: 13-80 M_jup, roughly Jupiter-sized due to degeneracy
+    // Radius nearly constant at ~0.1 R_sun for most of the range
+    double R_m = 0.1 * CONST_R_SUN;
+    double M_kg = mass_mjup * CONST_M_JUPITER;
 
-        WriteBodyToResult(result, i, {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "star_neutron"});
-    }
+    // Temperature: ~500-2500 K depending on mass and age
+    double T_k = 1000.0 + 1500.0 * (mass_mjup / 80.0);
+    double L_w = FOUR_PI_SIGMA * R_m * R_m * Pow4(T_k);
+    return {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "brown_dwarf"};
 }
 
 static void AstroBodyMakeBrownDwarf(DataChunk &args, ExpressionState &state, Vector &result) {
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, BrownDwarfBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_mjup = mass_ptr[input.sel->get_index(i)];
-
-        // Brown dwarfs: 13-80 M_jup, roughly Jupiter-sized due to degeneracy
-        // Radius nearly constant at ~0.1 R_sun for most of the range
-        double R_m = 0.1 * CONST_R_SUN;
-        double M_kg = mass_mjup * CONST_M_JUPITER;
+        writer.Write(i, BrownDwarfBody(mass_ptr[input.sel->get_index(i)]));
+    }
+}
 
-        // Temperature: ~500-2500 K depending on mass and age
-        double T_k = 1000.0 + 1500.0 * (mass_mjup / 80.0);
-        double L_w = 4.0 * M_PI * R_m * R_m * CONST_SIGMA_SB * pow(T_k, 4);
+static inline BodyProperties BlackHoleBody(double mass_msun) {
+    double M_kg = mass_msun * CONST_M_SUN;
+    // Schwarzschild radius: r_s = 2GM/c^2
+    double R_m = 2.0 * CONST_G * M_kg / (CONST_C * CONST_C);
 
-        WriteBodyToResult(result, i, {M_kg, R_m, L_w, T_k, ComputeDensity(M_kg, R_m), "brown_dwarf"});
-    }
+    // Black holes have no luminosity (except Hawking radiation, negligible for stellar mass)
+    // Temperature set to 0 for classical treatment
+    return {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "black_hole"};
 }
 
 static void AstroBodyMakeBlackHole(DataChunk &args, ExpressionState &state, Vector &result) {
     UnifiedVectorFormat input;
     args.data[0].ToUnifiedFormat(args.size(), input);
     auto mass_ptr = UnifiedVectorFormat::GetData<double>(input);
+    BodyVectorWriter writer(result);
 
+    if (!input.sel->IsSet() && input.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            writer.Write(i, BlackHoleBody(mass_ptr[i]));
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
-        double mass_msun = mass_ptr[input.sel->get_index(i)];
-
-        double M_kg = mass_msun * CONST_M_SUN;
-        // Schwarzschild radius: r_s = 2GM/c^2
-        double R_m = 2.0 * CONST_G * M_kg / (CONST_C * CONST_C);
-
-        // Black holes have no luminosity (except Hawking radiation, negligible for stellar mass)
-        // Temperature set to 0 for classical treatment
-        WriteBodyToResult(result, i, {M_kg, R_m, 0.0, 0.0, ComputeDensity(M_kg, R_m), "black_hole"});
+        writer.Write(i, BlackHoleBody(mass_ptr[input.sel->get_index(i)]));
     }
 }
 
 // Asteroid: inputs are radius_km and density_kg_m3
 static void AstroBodyMakeAsteroid(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+        if (ConstantVector::IsNull(args.data[0]) || ConstantVector::IsNull(args.data[1])) {
+            result.SetVectorType(VectorType::CONSTANT_VECTOR);
+            ConstantVector::SetNull(result, true);
+            return;
+        }
+        double radius_m = ConstantVector::GetData<double>(args.data[0])[0] * 1000.0;
+        double density = ConstantVector::GetData<double>(args.data[1])[0];
+        double volume = FOUR_THIRD_PI * Pow3(radius_m);
+        BodyVectorWriter writer(result);
+        writer.Write(0, {density * volume, radius_m, 0.0, 0.0, density, "asteroid"});
+        result.SetVectorType(VectorType::CONSTANT_VECTOR);
+        return;
+    }
     UnifiedVectorFormat r_fmt, d_fmt;
     args.data[0].ToUnifiedFormat(args.size(), r_fmt);
     args.data[1].ToUnifiedFormat(args.size(), d_fmt);
     auto r_ptr = UnifiedVectorFormat::GetData<double>(r_fmt);
     auto d_ptr = UnifiedVectorFormat::GetData<double>(d_fmt);
+    BodyVectorWriter writer(result);
 
+    if (!r_fmt.sel->IsSet() && r_fmt.validity.AllValid() &&
+        !d_fmt.sel->IsSet() && d_fmt.validity.AllValid()) {
+        for (idx_t i = 0; i < args.size(); i++) {
+            double radius_m = r_ptr[i] * 1000.0;  // km to m
+            double volume = FOUR_THIRD_PI * Pow3(radius_m);
+            writer.Write(i, {d_ptr[i] * volume, radius_m, 0.0, 0.0, d_ptr[i], "asteroid"});
+        }
+        return;
+    }
     for (idx_t i = 0; i < args.size(); i++) {
         double radius_m = r_ptr[r_fmt.sel->get_index(i)] * 1000.0;  // km to m
         double density = d_ptr[d_fmt.sel->get_index(i)];
 
-        double volume = (4.0 / 3.0) * M_PI * radius_m * radius_m * radius_m;
+        double volume = FOUR_THIRD_PI * Pow3(radius_m);
         double M_kg = density * volume;
 
-        WriteBodyToResult(result, i, {M_kg, radius_m, 0.0, 0.0, density, "asteroid"});
+        writer.Write(i, {M_kg, radius_m, 0.0, 0.0, density, "asteroid"});
     }
 }
 
@@ -544,28 +1056,72 @@ static void AstroOrbitMake(DataChunk &args, ExpressionState &state, Vector &resu
 
     // Copy numeric columns
     for (idx_t col = 0; col < 8; col++) {
+        auto out = FlatVector::GetData<double>(*children[col]);
+        if (IsFlatNoNulls(args.data[col])) {
+            // Flat input column: straight block copy instead of a gather
+            memcpy(out, FlatVector::GetData<double>(args.data[col]), args.size() * sizeof(double));
+            continue;
+        }
+        if (args.data[col].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+            !ConstantVector::IsNull(args.data[col])) {
+            double value = ConstantVector::GetData<double>(args.data[col])[0];
+            for (idx_t i = 0; i < args.size(); i++) {
+                out[i] = value;
+            }
+            continue;
+        }
         UnifiedVectorFormat fmt;
         args.data[col].ToUnifiedFormat(args.size(), fmt);
         auto ptr = UnifiedVectorFormat::GetData<double>(fmt);
-        auto out = FlatVector::GetData<double>(*children[col]);
         for (idx_t i = 0; i < args.size(); i++) {
             out[i] = ptr[fmt.sel->get_index(i)];
         }
     }
 
     // Copy frame string
+    auto frame_out = FlatVector::GetData<string_t>(*children[8]);
+    if (args.data[8].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[8])) {
+        // Frame literal: insert into the heap once and broadcast the handle
+        string_t frame_str = StringVector::AddString(*children[8],
+                                                     ConstantVector::GetData<string_t>(args.data[8])[0]);
+        for (idx_t i = 0; i < args.size(); i++) {
+            frame_out[i] = frame_str;
+        }
+        return;
+    }
     UnifiedVectorFormat fmt;
     args.data[8].ToUnifiedFormat(args.size(), fmt);
     auto ptr = UnifiedVectorFormat::GetData<string_t>(fmt);
     for (idx_t i = 0; i < args.size(); i++) {
-        FlatVector::GetData<string_t>(*children[8])[i] =
-            StringVector::AddString(*children[8], ptr[fmt.sel->get_index(i)].GetString());
+        frame_out[i] = StringVector::AddString(*children[8], ptr[fmt.sel->get_index(i)]);
+    }
+}
+
+// Batch kernels for the two Kepler's-third-law scalars. The domain check
+// is a branchless select: sqrt is computed unconditionally (it yields NaN
+// for negative arguments anyway) so the loop stays a straight-line
+// mul/div/sqrt chain the compiler can carry in vector registers.
+static void OrbitPeriodKernel(const double *a, const double *mass, double *out, idx_t count) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        double T = 2.0 * M_PI * sqrt(Pow3(a[i]) / (CONST_G * mass[i]));
+        out[i] = (a[i] > 0 && mass[i] > 0) ? T : nan;
+    }
+}
+
+static void OrbitMeanMotionKernel(const double *a, const double *mass, double *out, idx_t count) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        double n = sqrt(CONST_G * mass[i] / Pow3(a[i]));
+        out[i] = (a[i] > 0 && mass[i] > 0) ? n : nan;
     }
 }
 
 static void AstroOrbitPeriod(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    BinaryBatchDispatch<OrbitPeriodKernel>(args, result,
         [](double a_m, double M_kg) {
             if (a_m <= 0 || M_kg <= 0) return std::numeric_limits<double>::quiet_NaN();
             return 2.0 * M_PI * sqrt(a_m * a_m * a_m / (CONST_G * M_kg));
@@ -573,8 +1129,7 @@ static void AstroOrbitPeriod(DataChunk &args, ExpressionState &state, Vector &re
 }
 
 static void AstroOrbitMeanMotion(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    BinaryBatchDispatch<OrbitMeanMotionKernel>(args, result,
         [](double a_m, double M_kg) {
             if (a_m <= 0 || M_kg <= 0) return std::numeric_limits<double>::quiet_NaN();
             return sqrt(CONST_G * M_kg / (a_m * a_m * a_m));
@@ -583,7 +1138,8 @@ static void AstroOrbitMeanMotion(DataChunk &args, ExpressionState &state, Vector
 
 static void AstroOrbitPosition(DataChunk &args, ExpressionState &state, Vector &result) {
     auto &orbit_children = StructVector::GetEntries(args.data[0]);
-    auto &result_children = StructVector::GetEntries(result);
+    XyzPtrs out = GetXyzPtrs(result);
+    auto frame_out = FlatVector::GetData<string_t>(*out.frame);
 
     auto a = FlatVector::GetData<double>(*orbit_children[0]);
     auto e = FlatVector::GetData<double>(*orbit_children[1]);
@@ -595,28 +1151,52 @@ static void AstroOrbitPosition(DataChunk &args, ExpressionState &state, Vector &
     auto mass = FlatVector::GetData<double>(*orbit_children[7]);
     auto frame = FlatVector::GetData<string_t>(*orbit_children[8]);
 
-    auto x_out = FlatVector::GetData<double>(*result_children[0]);
-    auto y_out = FlatVector::GetData<double>(*result_children[1]);
-    auto z_out = FlatVector::GetData<double>(*result_children[2]);
-
     UnifiedVectorFormat t_fmt;
     args.data[1].ToUnifiedFormat(args.size(), t_fmt);
     auto t_ptr = UnifiedVectorFormat::GetData<double>(t_fmt);
 
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR && !ConstantVector::IsNull(args.data[0])) {
+        // One orbit evaluated at many times (the ephemeris query pattern):
+        // build the rotation frame and mean motion once, leaving only the
+        // Kepler solve and in-plane geometry per row
+        OrbitFrame f = BuildOrbitFrame(inc[0], omega[0], w[0]);
+        double n = OrbitMeanMotionRad(a[0], mass[0]);
+        string_t frame_str = StringVector::AddString(*out.frame, frame[0]);
+        // Block the times so the Kepler solve runs in lockstep over a
+        // scratch table and the geometry pass reads solved anomalies
+        double M_scratch[KEPLER_BLOCK], E_scratch[KEPLER_BLOCK];
+        for (idx_t base = 0; base < args.size(); base += KEPLER_BLOCK) {
+            idx_t count = MinValue<idx_t>(KEPLER_BLOCK, args.size() - base);
+            for (idx_t i = 0; i < count; i++) {
+                double t_jd = t_ptr[t_fmt.sel->get_index(base + i)];
+                M_scratch[i] = MeanAnomalyAt(M0[0], epoch[0], n, t_jd);
+            }
+            SolveKeplerBlock(M_scratch, e[0], E_scratch, count);
+            for (idx_t i = 0; i < count; i++) {
+                auto state = OrbitalStateFromEccentric(f, a[0], e[0], mass[0], E_scratch[i]);
+                out.x[base + i] = state.pos.x;
+                out.y[base + i] = state.pos.y;
+                out.z[base + i] = state.pos.z;
+                frame_out[base + i] = frame_str;
+            }
+        }
+        return;
+    }
+
     for (idx_t i = 0; i < args.size(); i++) {
         double t_jd = t_ptr[t_fmt.sel->get_index(i)];
         auto state = ComputeOrbitalState(a[i], e[i], inc[i], omega[i], w[i], M0[i], epoch[i], mass[i], t_jd);
-        x_out[i] = state.pos.x;
-        y_out[i] = state.pos.y;
-        z_out[i] = state.pos.z;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], frame[i].GetString());
+        out.x[i] = state.pos.x;
+        out.y[i] = state.pos.y;
+        out.z[i] = state.pos.z;
+        frame_out[i] = StringVector::AddString(*out.frame, frame[i]);
     }
 }
 
 static void AstroOrbitVelocity(DataChunk &args, ExpressionState &state, Vector &result) {
     auto &orbit_children = StructVector::GetEntries(args.data[0]);
-    auto &result_children = StructVector::GetEntries(result);
+    XyzPtrs out = GetXyzPtrs(result);
+    auto frame_out = FlatVector::GetData<string_t>(*out.frame);
 
     auto a = FlatVector::GetData<double>(*orbit_children[0]);
     auto e = FlatVector::GetData<double>(*orbit_children[1]);
@@ -628,22 +1208,42 @@ static void AstroOrbitVelocity(DataChunk &args, ExpressionState &state, Vector &
     auto mass = FlatVector::GetData<double>(*orbit_children[7]);
     auto frame = FlatVector::GetData<string_t>(*orbit_children[8]);
 
-    auto vx_out = FlatVector::GetData<double>(*result_children[0]);
-    auto vy_out = FlatVector::GetData<double>(*result_children[1]);
-    auto vz_out = FlatVector::GetData<double>(*result_children[2]);
-
     UnifiedVectorFormat t_fmt;
     args.data[1].ToUnifiedFormat(args.size(), t_fmt);
     auto t_ptr = UnifiedVectorFormat::GetData<double>(t_fmt);
 
+    if (args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR && !ConstantVector::IsNull(args.data[0])) {
+        // Same constant-orbit hoist as in AstroOrbitPosition
+        OrbitFrame f = BuildOrbitFrame(inc[0], omega[0], w[0]);
+        double n = OrbitMeanMotionRad(a[0], mass[0]);
+        string_t frame_str = StringVector::AddString(*out.frame, frame[0]);
+        // Same blocked lockstep Kepler solve as AstroOrbitPosition
+        double M_scratch[KEPLER_BLOCK], E_scratch[KEPLER_BLOCK];
+        for (idx_t base = 0; base < args.size(); base += KEPLER_BLOCK) {
+            idx_t count = MinValue<idx_t>(KEPLER_BLOCK, args.size() - base);
+            for (idx_t i = 0; i < count; i++) {
+                double t_jd = t_ptr[t_fmt.sel->get_index(base + i)];
+                M_scratch[i] = MeanAnomalyAt(M0[0], epoch[0], n, t_jd);
+            }
+            SolveKeplerBlock(M_scratch, e[0], E_scratch, count);
+            for (idx_t i = 0; i < count; i++) {
+                auto state = OrbitalStateFromEccentric(f, a[0], e[0], mass[0], E_scratch[i]);
+                out.x[base + i] = state.vel.x;
+                out.y[base + i] = state.vel.y;
+                out.z[base + i] = state.vel.z;
+                frame_out[base + i] = frame_str;
+            }
+        }
+        return;
+    }
+
     for (idx_t i = 0; i < args.size(); i++) {
         double t_jd = t_ptr[t_fmt.sel->get_index(i)];
         auto state = ComputeOrbitalState(a[i], e[i], inc[i], omega[i], w[i], M0[i], epoch[i], mass[i], t_jd);
-        vx_out[i] = state.vel.x;
-        vy_out[i] = state.vel.y;
-        vz_out[i] = state.vel.z;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], frame[i].GetString());
+        out.x[i] = state.vel.x;
+        out.y[i] = state.vel.y;
+        out.z[i] = state.vel.z;
+        frame_out[i] = StringVector::AddString(*out.frame, frame[i]);
     }
 }
 
@@ -651,22 +1251,12 @@ static void AstroOrbitVelocity(DataChunk &args, ExpressionState &state, Vector &
 // DYNAMICS FUNCTIONS
 // ============================================================================
 static void AstroDynGravityAccel(DataChunk &args, ExpressionState &state, Vector &result) {
-    auto &pos1_children = StructVector::GetEntries(args.data[1]);
-    auto &pos2_children = StructVector::GetEntries(args.data[3]);
-    auto &result_children = StructVector::GetEntries(result);
-
-    auto x1 = FlatVector::GetData<double>(*pos1_children[0]);
-    auto y1 = FlatVector::GetData<double>(*pos1_children[1]);
-    auto z1 = FlatVector::GetData<double>(*pos1_children[2]);
-    auto frame1 = FlatVector::GetData<string_t>(*pos1_children[3]);
+    XyzPtrs p1 = GetXyzPtrs(args.data[1]);
+    XyzPtrs p2 = GetXyzPtrs(args.data[3]);
+    XyzPtrs out = GetXyzPtrs(result);
 
-    auto x2 = FlatVector::GetData<double>(*pos2_children[0]);
-    auto y2 = FlatVector::GetData<double>(*pos2_children[1]);
-    auto z2 = FlatVector::GetData<double>(*pos2_children[2]);
-
-    auto ax_out = FlatVector::GetData<double>(*result_children[0]);
-    auto ay_out = FlatVector::GetData<double>(*result_children[1]);
-    auto az_out = FlatVector::GetData<double>(*result_children[2]);
+    auto frame1 = FlatVector::GetData<string_t>(*p1.frame);
+    auto frame_out = FlatVector::GetData<string_t>(*out.frame);
 
     UnifiedVectorFormat m2_fmt;
     args.data[2].ToUnifiedFormat(args.size(), m2_fmt);
@@ -674,19 +1264,25 @@ static void AstroDynGravityAccel(DataChunk &args, ExpressionState &state, Vector
 
     for (idx_t i = 0; i < args.size(); i++) {
         double m2 = m2_ptr[m2_fmt.sel->get_index(i)];
-        Vec3 r = {x2[i] - x1[i], y2[i] - y1[i], z2[i] - z1[i]};
-        double r3 = r.length2() * r.length();
-
-        if (r3 < 1e-30) {
-            ax_out[i] = ay_out[i] = az_out[i] = 0.0;
-        } else {
-            double factor = CONST_G * m2 / r3;
-            ax_out[i] = factor * r.x;
-            ay_out[i] = factor * r.y;
-            az_out[i] = factor * r.z;
-        }
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], frame1[i].GetString());
+        // Straight SoA arithmetic: r^2 is computed once and r^3 = r^2*sqrt(r^2),
+        // instead of the Vec3 transient that walked the components twice for
+        // length2() and length(). The coincident-body guard is a select so
+        // the loop body stays branch-free (the stray inf from a near-zero
+        // divide is discarded by the select before it is used).
+        double dx = p2.x[i] - p1.x[i];
+        double dy = p2.y[i] - p1.y[i];
+        double dz = p2.z[i] - p1.z[i];
+        double r2 = dx * dx + dy * dy + dz * dz;
+        // One reciprocal feeding three multiplies; r2 < 1e-20 is the same
+        // threshold as the former r3 < 1e-30 guard
+        double inv_r3 = 1.0 / (r2 * sqrt(r2));
+
+        double factor = CONST_G * m2 * inv_r3;
+        factor = r2 < 1e-20 ? 0.0 : factor;
+        out.x[i] = factor * dx;
+        out.y[i] = factor * dy;
+        out.z[i] = factor * dz;
+        frame_out[i] = StringVector::AddString(*out.frame, frame1[i]);
     }
 }
 
@@ -695,17 +1291,40 @@ static void AstroDynGravityAccel(DataChunk &args, ExpressionState &state, Vector
 // ============================================================================
 // Supported: icrs <-> galactic (fixed rotation)
 // barycentric = icrs (synonym for solar system context)
-static void AstroFrameTransformPos(DataChunk &args, ExpressionState &state, Vector &result) {
-    auto &pos_children = StructVector::GetEntries(args.data[0]);
-    auto &result_children = StructVector::GetEntries(result);
+enum class Frame : uint8_t { ICRS, GALACTIC };
+
+// Case-insensitive match against a lowercase literal without allocating.
+// Frame names are pure ASCII letters, so OR-ing 0x20 lowercases them.
+static inline bool FrameNameEquals(const char *data, idx_t len, const char *literal) {
+    for (idx_t i = 0; i < len; i++) {
+        if ((data[i] | 0x20) != literal[i]) {
+            return false;
+        }
+    }
+    return literal[len] == '\0';
+}
 
-    auto x_in = FlatVector::GetData<double>(*pos_children[0]);
-    auto y_in = FlatVector::GetData<double>(*pos_children[1]);
-    auto z_in = FlatVector::GetData<double>(*pos_children[2]);
+static Frame ResolveFrame(string_t name) {
+    auto data = name.GetData();
+    auto len = name.GetSize();
+    if (FrameNameEquals(data, len, "icrs") || FrameNameEquals(data, len, "barycentric")) {
+        return Frame::ICRS;
+    }
+    if (FrameNameEquals(data, len, "galactic")) {
+        return Frame::GALACTIC;
+    }
+    throw InvalidInputException(
+        "Frame '%s' not supported. Supported: icrs/barycentric <-> galactic", name.GetString());
+}
 
-    auto x_out = FlatVector::GetData<double>(*result_children[0]);
-    auto y_out = FlatVector::GetData<double>(*result_children[1]);
-    auto z_out = FlatVector::GetData<double>(*result_children[2]);
+static inline const char *FrameName(Frame f) {
+    return f == Frame::GALACTIC ? "galactic" : "icrs";
+}
+
+static void AstroFrameTransformPos(DataChunk &args, ExpressionState &state, Vector &result) {
+    XyzPtrs in = GetXyzPtrs(args.data[0]);
+    XyzPtrs out = GetXyzPtrs(result);
+    auto frame_out = FlatVector::GetData<string_t>(*out.frame);
 
     UnifiedVectorFormat from_fmt, to_fmt;
     args.data[1].ToUnifiedFormat(args.size(), from_fmt);
@@ -713,51 +1332,53 @@ static void AstroFrameTransformPos(DataChunk &args, ExpressionState &state, Vect
     auto from_ptr = UnifiedVectorFormat::GetData<string_t>(from_fmt);
     auto to_ptr = UnifiedVectorFormat::GetData<string_t>(to_fmt);
 
-    Mat3 icrs_to_gal = GetICRSToGalacticMatrix();
-    Mat3 gal_to_icrs = icrs_to_gal.transpose();
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        args.data[2].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1]) && !ConstantVector::IsNull(args.data[2])) {
+        // Frame names are almost always query literals: resolve the pair and
+        // the output frame string once, leaving a pure rotate (or copy) loop
+        Frame from = ResolveFrame(from_ptr[from_fmt.sel->get_index(0)]);
+        Frame to = ResolveFrame(to_ptr[to_fmt.sel->get_index(0)]);
+        string_t to_str = StringVector::AddString(*out.frame, FrameName(to));
+        if (from == to) {
+            memcpy(out.x, in.x, args.size() * sizeof(double));
+            memcpy(out.y, in.y, args.size() * sizeof(double));
+            memcpy(out.z, in.z, args.size() * sizeof(double));
+        } else {
+            const Mat3 &m = from == Frame::ICRS ? ICRS_TO_GAL : GAL_TO_ICRS;
+            Mat3ApplyBatch(m, in.x, in.y, in.z, out.x, out.y, out.z, args.size());
+        }
+        for (idx_t i = 0; i < args.size(); i++) {
+            frame_out[i] = to_str;
+        }
+        return;
+    }
 
     for (idx_t i = 0; i < args.size(); i++) {
-        string from_frame = StringUtil::Lower(from_ptr[from_fmt.sel->get_index(i)].GetString());
-        string to_frame = StringUtil::Lower(to_ptr[to_fmt.sel->get_index(i)].GetString());
-
-        // Normalize frame names
-        if (from_frame == "barycentric" || from_frame == "icrs") from_frame = "icrs";
-        if (to_frame == "barycentric" || to_frame == "icrs") to_frame = "icrs";
+        Frame from = ResolveFrame(from_ptr[from_fmt.sel->get_index(i)]);
+        Frame to = ResolveFrame(to_ptr[to_fmt.sel->get_index(i)]);
 
-        Vec3 pos = {x_in[i], y_in[i], z_in[i]};
+        Vec3 pos = {in.x[i], in.y[i], in.z[i]};
         Vec3 result_pos;
-
-        if (from_frame == to_frame) {
+        if (from == to) {
             result_pos = pos;
-        } else if (from_frame == "icrs" && to_frame == "galactic") {
-            result_pos = icrs_to_gal.apply(pos);
-        } else if (from_frame == "galactic" && to_frame == "icrs") {
-            result_pos = gal_to_icrs.apply(pos);
+        } else if (from == Frame::ICRS) {
+            result_pos = ICRS_TO_GAL.apply(pos);
         } else {
-            throw InvalidInputException(
-                "Frame transform '%s' -> '%s' not supported. Supported: icrs/barycentric <-> galactic",
-                from_frame.c_str(), to_frame.c_str());
+            result_pos = GAL_TO_ICRS.apply(pos);
         }
 
-        x_out[i] = result_pos.x;
-        y_out[i] = result_pos.y;
-        z_out[i] = result_pos.z;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], to_frame);
+        out.x[i] = result_pos.x;
+        out.y[i] = result_pos.y;
+        out.z[i] = result_pos.z;
+        frame_out[i] = StringVector::AddString(*out.frame, FrameName(to));
     }
 }
 
 static void AstroFrameTransformVel(DataChunk &args, ExpressionState &state, Vector &result) {
-    auto &vel_children = StructVector::GetEntries(args.data[0]);
-    auto &result_children = StructVector::GetEntries(result);
-
-    auto vx_in = FlatVector::GetData<double>(*vel_children[0]);
-    auto vy_in = FlatVector::GetData<double>(*vel_children[1]);
-    auto vz_in = FlatVector::GetData<double>(*vel_children[2]);
-
-    auto vx_out = FlatVector::GetData<double>(*result_children[0]);
-    auto vy_out = FlatVector::GetData<double>(*result_children[1]);
-    auto vz_out = FlatVector::GetData<double>(*result_children[2]);
+    XyzPtrs in = GetXyzPtrs(args.data[0]);
+    XyzPtrs out = GetXyzPtrs(result);
+    auto frame_out = FlatVector::GetData<string_t>(*out.frame);
 
     UnifiedVectorFormat from_fmt, to_fmt;
     args.data[1].ToUnifiedFormat(args.size(), from_fmt);
@@ -765,36 +1386,45 @@ static void AstroFrameTransformVel(DataChunk &args, ExpressionState &state, Vect
     auto from_ptr = UnifiedVectorFormat::GetData<string_t>(from_fmt);
     auto to_ptr = UnifiedVectorFormat::GetData<string_t>(to_fmt);
 
-    Mat3 icrs_to_gal = GetICRSToGalacticMatrix();
-    Mat3 gal_to_icrs = icrs_to_gal.transpose();
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        args.data[2].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1]) && !ConstantVector::IsNull(args.data[2])) {
+        // Same constant-frame hoist as in AstroFrameTransformPos
+        Frame from = ResolveFrame(from_ptr[from_fmt.sel->get_index(0)]);
+        Frame to = ResolveFrame(to_ptr[to_fmt.sel->get_index(0)]);
+        string_t to_str = StringVector::AddString(*out.frame, FrameName(to));
+        if (from == to) {
+            memcpy(out.x, in.x, args.size() * sizeof(double));
+            memcpy(out.y, in.y, args.size() * sizeof(double));
+            memcpy(out.z, in.z, args.size() * sizeof(double));
+        } else {
+            const Mat3 &m = from == Frame::ICRS ? ICRS_TO_GAL : GAL_TO_ICRS;
+            Mat3ApplyBatch(m, in.x, in.y, in.z, out.x, out.y, out.z, args.size());
+        }
+        for (idx_t i = 0; i < args.size(); i++) {
+            frame_out[i] = to_str;
+        }
+        return;
+    }
 
     for (idx_t i = 0; i < args.size(); i++) {
-        string from_frame = StringUtil::Lower(from_ptr[from_fmt.sel->get_index(i)].GetString());
-        string to_frame = StringUtil::Lower(to_ptr[to_fmt.sel->get_index(i)].GetString());
+        Frame from = ResolveFrame(from_ptr[from_fmt.sel->get_index(i)]);
+        Frame to = ResolveFrame(to_ptr[to_fmt.sel->get_index(i)]);
 
-        if (from_frame == "barycentric" || from_frame == "icrs") from_frame = "icrs";
-        if (to_frame == "barycentric" || to_frame == "icrs") to_frame = "icrs";
-
-        Vec3 vel = {vx_in[i], vy_in[i], vz_in[i]};
+        Vec3 vel = {in.x[i], in.y[i], in.z[i]};
         Vec3 result_vel;
-
-        if (from_frame == to_frame) {
+        if (from == to) {
             result_vel = vel;
-        } else if (from_frame == "icrs" && to_frame == "galactic") {
-            result_vel = icrs_to_gal.apply(vel);
-        } else if (from_frame == "galactic" && to_frame == "icrs") {
-            result_vel = gal_to_icrs.apply(vel);
+        } else if (from == Frame::ICRS) {
+            result_vel = ICRS_TO_GAL.apply(vel);
         } else {
-            throw InvalidInputException(
-                "Frame transform '%s' -> '%s' not supported. Supported: icrs/barycentric <-> galactic",
-                from_frame.c_str(), to_frame.c_str());
+            result_vel = GAL_TO_ICRS.apply(vel);
         }
 
-        vx_out[i] = result_vel.x;
-        vy_out[i] = result_vel.y;
-        vz_out[i] = result_vel.z;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], to_frame);
+        out.x[i] = result_vel.x;
+        out.y[i] = result_vel.y;
+        out.z[i] = result_vel.z;
+        frame_out[i] = StringVector::AddString(*out.frame, FrameName(to));
     }
 }
 
@@ -820,10 +1450,29 @@ static void AstroSectorId(DataChunk &args, ExpressionState &state, Vector &resul
     auto z_ptr = UnifiedVectorFormat::GetData<double>(z_fmt);
     auto level_ptr = UnifiedVectorFormat::GetData<int32_t>(level_fmt);
 
+    if (args.data[3].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[3])) {
+        // The level is almost always a query literal: validate it and look
+        // up the cell size once, and turn the per-row division into a
+        // multiply by the reciprocal
+        int32_t level = ConstantVector::GetData<int32_t>(args.data[3])[0];
+        if (level < 0 || level >= 64) {
+            throw InvalidInputException("Sector level must be in [0, 64), got %d", level);
+        }
+        double inv_size = 1.0 / GetSectorSize(level);
+        for (idx_t i = 0; i < args.size(); i++) {
+            sx_out[i] = static_cast<int64_t>(floor(x_ptr[x_fmt.sel->get_index(i)] * inv_size));
+            sy_out[i] = static_cast<int64_t>(floor(y_ptr[y_fmt.sel->get_index(i)] * inv_size));
+            sz_out[i] = static_cast<int64_t>(floor(z_ptr[z_fmt.sel->get_index(i)] * inv_size));
+            level_out[i] = level;
+        }
+        return;
+    }
+
     for (idx_t i = 0; i < args.size(); i++) {
         int32_t level = level_ptr[level_fmt.sel->get_index(i)];
-        if (level < 0) {
-            throw InvalidInputException("Sector level must be >= 0, got %d", level);
+        if (level < 0 || level >= 64) {
+            throw InvalidInputException("Sector level must be in [0, 64), got %d", level);
         }
 
         double size = GetSectorSize(level);
@@ -847,13 +1496,30 @@ static void AstroSectorCenter(DataChunk &args, ExpressionState &state, Vector &r
     auto y_out = FlatVector::GetData<double>(*result_children[1]);
     auto z_out = FlatVector::GetData<double>(*result_children[2]);
 
-    for (idx_t i = 0; i < args.size(); i++) {
-        double size = GetSectorSize(level[i]);
-        x_out[i] = (sx[i] + 0.5) * size;
-        y_out[i] = (sy[i] + 0.5) * size;
-        z_out[i] = (sz[i] + 0.5) * size;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], "barycentric");
+    auto frame_out = FlatVector::GetData<string_t>(*result_children[3]);
+    string_t frame_str = StringVector::AddString(*result_children[3], "barycentric");
+
+    // Size pre-pass (validation + table lookup), then one tight loop per
+    // output field so each child column streams through cache on its own
+    idx_t count = args.size();
+    double size[STANDARD_VECTOR_SIZE];
+    for (idx_t i = 0; i < count; i++) {
+        if (level[i] < 0 || level[i] >= 64) {
+            throw InvalidInputException("Sector level must be in [0, 64), got %d", level[i]);
+        }
+        size[i] = GetSectorSize(level[i]);
+    }
+    for (idx_t i = 0; i < count; i++) {
+        x_out[i] = (sx[i] + 0.5) * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        y_out[i] = (sy[i] + 0.5) * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        z_out[i] = (sz[i] + 0.5) * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        frame_out[i] = frame_str;
     }
 }
 
@@ -873,14 +1539,33 @@ static void AstroSectorBounds(DataChunk &args, ExpressionState &state, Vector &r
     auto min_z = FlatVector::GetData<double>(*result_children[4]);
     auto max_z = FlatVector::GetData<double>(*result_children[5]);
 
-    for (idx_t i = 0; i < args.size(); i++) {
-        double size = GetSectorSize(level[i]);
-        min_x[i] = sx[i] * size;
-        max_x[i] = (sx[i] + 1) * size;
-        min_y[i] = sy[i] * size;
-        max_y[i] = (sy[i] + 1) * size;
-        min_z[i] = sz[i] * size;
-        max_z[i] = (sz[i] + 1) * size;
+    // Same validating per-field split as AstroSectorCenter: resolve the cell
+    // size once, then fill the six bound columns in separate streaming loops
+    idx_t count = args.size();
+    double size[STANDARD_VECTOR_SIZE];
+    for (idx_t i = 0; i < count; i++) {
+        if (level[i] < 0 || level[i] >= 64) {
+            throw InvalidInputException("Sector level must be in [0, 64), got %d", level[i]);
+        }
+        size[i] = GetSectorSize(level[i]);
+    }
+    for (idx_t i = 0; i < count; i++) {
+        min_x[i] = sx[i] * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        max_x[i] = (sx[i] + 1) * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        min_y[i] = sy[i] * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        max_y[i] = (sy[i] + 1) * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        min_z[i] = sz[i] * size[i];
+    }
+    for (idx_t i = 0; i < count; i++) {
+        max_z[i] = (sz[i] + 1) * size[i];
     }
 }
 
@@ -917,6 +1602,34 @@ static void AstroSectorParent(DataChunk &args, ExpressionState &state, Vector &r
 // ============================================================================
 // COORDINATE CONVERSION (RA/Dec <-> Cartesian)
 // ============================================================================
+// Block size for the trig pre-pass scratch tables: four double arrays of 256
+// rows (8 KB) stay resident in L1 between the two passes.
+constexpr idx_t RADEC_TRIG_BLOCK = 256;
+
+// Flat fast path: pass 1 fills sin/cos tables for RA and Dec in tight
+// trig-only loops (the shape vector math libraries batch best), pass 2
+// assembles the Cartesian components from the tables.
+static void RadecToXyzKernel(const double *ra, const double *dec, const double *dist,
+                             double *x_out, double *y_out, double *z_out, idx_t count) {
+    double sra[RADEC_TRIG_BLOCK], cra[RADEC_TRIG_BLOCK];
+    double sdec[RADEC_TRIG_BLOCK], cdec[RADEC_TRIG_BLOCK];
+    for (idx_t base = 0; base < count; base += RADEC_TRIG_BLOCK) {
+        idx_t n = MinValue<idx_t>(RADEC_TRIG_BLOCK, count - base);
+        for (idx_t i = 0; i < n; i++) {
+            SinCos(ra[base + i] * DEG_TO_RAD, sra[i], cra[i]);
+        }
+        for (idx_t i = 0; i < n; i++) {
+            SinCos(dec[base + i] * DEG_TO_RAD, sdec[i], cdec[i]);
+        }
+        for (idx_t i = 0; i < n; i++) {
+            double d = dist[base + i];
+            x_out[base + i] = d * cdec[i] * cra[i];
+            y_out[base + i] = d * cdec[i] * sra[i];
+            z_out[base + i] = d * sdec[i];
+        }
+    }
+}
+
 static void AstroRadecToXyz(DataChunk &args, ExpressionState &state, Vector &result) {
     auto &result_children = StructVector::GetEntries(result);
 
@@ -924,6 +1637,20 @@ static void AstroRadecToXyz(DataChunk &args, ExpressionState &state, Vector &res
     auto y_out = FlatVector::GetData<double>(*result_children[1]);
     auto z_out = FlatVector::GetData<double>(*result_children[2]);
 
+    if (IsFlatNoNulls(args.data[0]) && IsFlatNoNulls(args.data[1]) && IsFlatNoNulls(args.data[2])) {
+        RadecToXyzKernel(FlatVector::GetData<double>(args.data[0]),
+                         FlatVector::GetData<double>(args.data[1]),
+                         FlatVector::GetData<double>(args.data[2]),
+                         x_out, y_out, z_out, args.size());
+        // The output frame is a fixed literal: one heap insert, N handle stores
+        auto frame_out = FlatVector::GetData<string_t>(*result_children[3]);
+        string_t icrs_str = StringVector::AddString(*result_children[3], "icrs");
+        for (idx_t i = 0; i < args.size(); i++) {
+            frame_out[i] = icrs_str;
+        }
+        return;
+    }
+
     UnifiedVectorFormat ra_fmt, dec_fmt, dist_fmt;
     args.data[0].ToUnifiedFormat(args.size(), ra_fmt);
     args.data[1].ToUnifiedFormat(args.size(), dec_fmt);
@@ -933,21 +1660,65 @@ static void AstroRadecToXyz(DataChunk &args, ExpressionState &state, Vector &res
     auto dec_ptr = UnifiedVectorFormat::GetData<double>(dec_fmt);
     auto dist_ptr = UnifiedVectorFormat::GetData<double>(dist_fmt);
 
+    auto frame_out = FlatVector::GetData<string_t>(*result_children[3]);
+    string_t icrs_str = StringVector::AddString(*result_children[3], "icrs");
     for (idx_t i = 0; i < args.size(); i++) {
         double ra = ra_ptr[ra_fmt.sel->get_index(i)] * DEG_TO_RAD;
         double dec = dec_ptr[dec_fmt.sel->get_index(i)] * DEG_TO_RAD;
         double dist = dist_ptr[dist_fmt.sel->get_index(i)];
 
-        Vec3 v = SphericalToCartesian(ra, dec) * dist;
-        x_out[i] = v.x;
-        y_out[i] = v.y;
-        z_out[i] = v.z;
-        FlatVector::GetData<string_t>(*result_children[3])[i] =
-            StringVector::AddString(*result_children[3], "icrs");
+        // Components written straight to the SoA outputs — no Vec3 hop
+        double sra, cra, sdec, cdec;
+        SinCos(ra, sra, cra);
+        SinCos(dec, sdec, cdec);
+        x_out[i] = dist * cdec * cra;
+        y_out[i] = dist * cdec * sra;
+        z_out[i] = dist * sdec;
+        frame_out[i] = icrs_str;
+    }
+}
+
+// Haversine term a = sin^2(ddec/2) + cos(d1)*cos(d2)*sin^2(dra/2), in [0,1].
+// Inputs in degrees; rounding can push a marginally above 1, callers clamp.
+// The four trig arguments are all distinct angles, so there is no sin/cos
+// pair to fuse here (unlike the radec and orbital kernels, which share
+// reductions via SinCos); the half-angle scale is folded into one constant
+// per difference instead.
+constexpr double DEG_TO_RAD_HALF = DEG_TO_RAD / 2.0;
+
+static inline double HaversineA(double ra1, double dec1, double ra2, double dec2) {
+    double sdec = sin((dec2 - dec1) * DEG_TO_RAD_HALF);
+    double sra = sin((ra2 - ra1) * DEG_TO_RAD_HALF);
+    return sdec * sdec + cos(dec1 * DEG_TO_RAD) * cos(dec2 * DEG_TO_RAD) * sra * sra;
+}
+
+// Batched haversine over contiguous arrays (flat, all-valid fast path).
+// A plain stride-1 loop with no selection indirection or validity checks,
+// so the compiler can unroll and auto-vectorize the trig-heavy body.
+// asin(sqrt(a)) is exact for a in [0,1] and saves one sqrt and the atan2.
+static void AngularSeparationKernel(const double *ra1, const double *dec1,
+                                    const double *ra2, const double *dec2,
+                                    double *out, idx_t count) {
+    for (idx_t i = 0; i < count; i++) {
+        double a = HaversineA(ra1[i], dec1[i], ra2[i], dec2[i]);
+        out[i] = 2.0 * asin(sqrt(a < 1.0 ? a : 1.0)) * RAD_TO_DEG;
     }
 }
 
 static void AstroAngularSeparation(DataChunk &args, ExpressionState &state, Vector &result) {
+    // Fast path decided at the Vector level, before paying for unified
+    // formats: flat no-null inputs go straight to the batched kernel.
+    if (IsFlatNoNulls(args.data[0]) && IsFlatNoNulls(args.data[1]) &&
+        IsFlatNoNulls(args.data[2]) && IsFlatNoNulls(args.data[3])) {
+        result.SetVectorType(VectorType::FLAT_VECTOR);
+        AngularSeparationKernel(FlatVector::GetData<double>(args.data[0]),
+                                FlatVector::GetData<double>(args.data[1]),
+                                FlatVector::GetData<double>(args.data[2]),
+                                FlatVector::GetData<double>(args.data[3]),
+                                FlatVector::GetData<double>(result), args.size());
+        return;
+    }
+
     UnifiedVectorFormat ra1_fmt, dec1_fmt, ra2_fmt, dec2_fmt;
     args.data[0].ToUnifiedFormat(args.size(), ra1_fmt);
     args.data[1].ToUnifiedFormat(args.size(), dec1_fmt);
@@ -961,6 +1732,20 @@ static void AstroAngularSeparation(DataChunk &args, ExpressionState &state, Vect
     auto out = FlatVector::GetData<double>(result);
     auto &validity = FlatVector::Validity(result);
 
+    if (!ra1_fmt.sel->IsSet() && !dec1_fmt.sel->IsSet() &&
+        !ra2_fmt.sel->IsSet() && !dec2_fmt.sel->IsSet()) {
+        // Identity selections with NULLs: AND the four input masks into the
+        // result mask 64 rows at a time, then run the kernel over every lane.
+        // NULL lanes compute to NaN, which the merged mask hides — no
+        // per-row 4-way validity branch.
+        validity.Combine(ra1_fmt.validity, args.size());
+        validity.Combine(dec1_fmt.validity, args.size());
+        validity.Combine(ra2_fmt.validity, args.size());
+        validity.Combine(dec2_fmt.validity, args.size());
+        AngularSeparationKernel(ra1, dec1, ra2, dec2, out, args.size());
+        return;
+    }
+
     for (idx_t i = 0; i < args.size(); i++) {
         auto i1 = ra1_fmt.sel->get_index(i);
         auto i2 = dec1_fmt.sel->get_index(i);
@@ -974,71 +1759,486 @@ static void AstroAngularSeparation(DataChunk &args, ExpressionState &state, Vect
         }
 
         // Haversine formula
-        double r1 = ra1[i1] * DEG_TO_RAD, d1 = dec1[i2] * DEG_TO_RAD;
-        double r2 = ra2[i3] * DEG_TO_RAD, d2 = dec2[i4] * DEG_TO_RAD;
-        double sdec = sin((d2 - d1) / 2);
-        double sra = sin((r2 - r1) / 2);
-        double a = sdec * sdec + cos(d1) * cos(d2) * sra * sra;
-        out[i] = 2.0 * atan2(sqrt(a), sqrt(1.0 - a)) * RAD_TO_DEG;
+        double a = HaversineA(ra1[i1], dec1[i2], ra2[i3], dec2[i4]);
+        out[i] = 2.0 * asin(sqrt(a < 1.0 ? a : 1.0)) * RAD_TO_DEG;
+    }
+}
+
+// cos(separation) = 1 - 2a: monotonic in the separation but needs neither
+// sqrt nor an inverse trig call. WHERE astro_angular_separation(...) < theta
+// can be rewritten as astro_angular_separation_cos(...) > cos(theta).
+static void AstroAngularSeparationCos(DataChunk &args, ExpressionState &state, Vector &result) {
+    UnifiedVectorFormat ra1_fmt, dec1_fmt, ra2_fmt, dec2_fmt;
+    args.data[0].ToUnifiedFormat(args.size(), ra1_fmt);
+    args.data[1].ToUnifiedFormat(args.size(), dec1_fmt);
+    args.data[2].ToUnifiedFormat(args.size(), ra2_fmt);
+    args.data[3].ToUnifiedFormat(args.size(), dec2_fmt);
+
+    auto ra1 = UnifiedVectorFormat::GetData<double>(ra1_fmt);
+    auto dec1 = UnifiedVectorFormat::GetData<double>(dec1_fmt);
+    auto ra2 = UnifiedVectorFormat::GetData<double>(ra2_fmt);
+    auto dec2 = UnifiedVectorFormat::GetData<double>(dec2_fmt);
+    auto out = FlatVector::GetData<double>(result);
+    auto &validity = FlatVector::Validity(result);
+
+    if (!ra1_fmt.sel->IsSet() && !dec1_fmt.sel->IsSet() &&
+        !ra2_fmt.sel->IsSet() && !dec2_fmt.sel->IsSet()) {
+        // Same word-wise mask merge as AstroAngularSeparation
+        validity.Combine(ra1_fmt.validity, args.size());
+        validity.Combine(dec1_fmt.validity, args.size());
+        validity.Combine(ra2_fmt.validity, args.size());
+        validity.Combine(dec2_fmt.validity, args.size());
+        for (idx_t i = 0; i < args.size(); i++) {
+            out[i] = 1.0 - 2.0 * HaversineA(ra1[i], dec1[i], ra2[i], dec2[i]);
+        }
+        return;
+    }
+
+    for (idx_t i = 0; i < args.size(); i++) {
+        auto i1 = ra1_fmt.sel->get_index(i);
+        auto i2 = dec1_fmt.sel->get_index(i);
+        auto i3 = ra2_fmt.sel->get_index(i);
+        auto i4 = dec2_fmt.sel->get_index(i);
+
+        if (!ra1_fmt.validity.RowIsValid(i1) || !dec1_fmt.validity.RowIsValid(i2) ||
+            !ra2_fmt.validity.RowIsValid(i3) || !dec2_fmt.validity.RowIsValid(i4)) {
+            validity.SetInvalid(i);
+            continue;
+        }
+
+        out[i] = 1.0 - 2.0 * HaversineA(ra1[i1], dec1[i2], ra2[i3], dec2[i4]);
     }
 }
 
 // ============================================================================
 // PHOTOMETRY FUNCTIONS
 // ============================================================================
+// pow(10, (zp-mag)/2.5) == exp2((zp-mag) * log2(10)/2.5). exp2 has the
+// most direct reduction of the exp family (exponent extract + polynomial
+// on the fraction), and the inverse uses log2 for the same reason:
+// -2.5*log10(f) + zp == zp - (2.5/log2(10)) * log2(f).
+constexpr double LOG2_10_OVER_2P5 = 1.3287712379549449;   // log2(10)/2.5
+constexpr double P2P5_OVER_LOG2_10 = 0.7525749891599529;  // 2.5/log2(10)
+
+static void MagToFluxKernel(const double *mag, const double *zp, double *out, idx_t count) {
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        ASTRO_PREFETCH(&mag[i + 64]);
+        ASTRO_PREFETCH(&zp[i + 64]);
+        out[i] = exp2((zp[i] - mag[i]) * LOG2_10_OVER_2P5);
+    }
+}
+
 static void AstroMagToFlux(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
-        [](double mag, double zp) { return pow(10.0, (zp - mag) / 2.5); });
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1])) {
+        // Constant zero point: fold it into the exponent offset once
+        const double k = ConstantVector::GetData<double>(args.data[1])[0] * LOG2_10_OVER_2P5;
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [k](double mag) { return exp2(k - mag * LOG2_10_OVER_2P5); });
+        return;
+    }
+    BinaryBatchDispatch<MagToFluxKernel>(args, result,
+        [](double mag, double zp) { return exp2((zp - mag) * LOG2_10_OVER_2P5); });
+}
+
+// Branchless flat kernel: log10 runs unconditionally (negative inputs
+// yield NaN from libm anyway) and the domain check is a select, so the
+// loop is a shape vector math libraries can batch.
+static void FluxToMagKernel(const double *flux, const double *zp, double *out, idx_t count) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        ASTRO_PREFETCH(&flux[i + 64]);
+        ASTRO_PREFETCH(&zp[i + 64]);
+        // Invalid rows are clamped to 1 before the log so libm never sees a
+        // domain error (errno / FP flags), then blended to NaN afterwards
+        double safe = flux[i] > 0 ? flux[i] : 1.0;
+        double mag = MulAdd(-P2P5_OVER_LOG2_10, log2(safe), zp[i]);
+        out[i] = flux[i] > 0 ? mag : nan;
+    }
 }
 
 static void AstroFluxToMag(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1])) {
+        const double zp = ConstantVector::GetData<double>(args.data[1])[0];
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [zp](double flux) {
+                // Clamp-compute-blend, same as FluxToMagKernel
+                double safe = flux > 0 ? flux : 1.0;
+                double mag = MulAdd(-P2P5_OVER_LOG2_10, log2(safe), zp);
+                return flux > 0 ? mag : std::numeric_limits<double>::quiet_NaN();
+            });
+        return;
+    }
+    BinaryBatchDispatch<FluxToMagKernel>(args, result,
         [](double flux, double zp) {
-            return flux > 0 ? -2.5 * log10(flux) + zp : std::numeric_limits<double>::quiet_NaN();
+            double safe = flux > 0 ? flux : 1.0;
+            double mag = MulAdd(-P2P5_OVER_LOG2_10, log2(safe), zp);
+            return flux > 0 ? mag : std::numeric_limits<double>::quiet_NaN();
         });
 }
 
+// 5*log10(d) - 5 over a contiguous chunk. log10 is evaluated unconditionally
+// and non-positive inputs blended to NaN afterwards, so the domain check
+// compiles to a select instead of a data-dependent branch.
+static void DistanceModulusKernel(const double *dist, double *out, idx_t count) {
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        double dm = MulAdd(5.0, log10(dist[i]), -5.0);
+        out[i] = dist[i] > 0 ? dm : std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
 static void AstroDistanceModulus(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (IsFlatNoNulls(args.data[0])) {
+        result.SetVectorType(VectorType::FLAT_VECTOR);
+        DistanceModulusKernel(FlatVector::GetData<double>(args.data[0]),
+                              FlatVector::GetData<double>(result), args.size());
+        return;
+    }
     UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
         [](double dist_pc) {
-            return dist_pc > 0 ? 5.0 * log10(dist_pc) - 5.0 : std::numeric_limits<double>::quiet_NaN();
+            double dm = MulAdd(5.0, log10(dist_pc), -5.0);
+            return dist_pc > 0 ? dm : std::numeric_limits<double>::quiet_NaN();
         });
 }
 
+// 256-entry mantissa table for the approximate distance modulus: LOG10_HI
+// holds log10(1 + i/256) and INV_BASE the matching reciprocal 256/(256+i),
+// filled once at extension load.
+struct Log10Lut {
+    double log10_hi[256];
+    double inv_base[256];
+    Log10Lut() {
+        for (int i = 0; i < 256; i++) {
+            log10_hi[i] = log10(1.0 + i / 256.0);
+            inv_base[i] = 256.0 / (256.0 + i);
+        }
+    }
+};
+static const Log10Lut LOG10_LUT;
+
+constexpr double LOG10_2 = 0.30102999566398120;  // log10(2)
+constexpr double LOG10_E = 0.43429448190325176;  // log10(e)
+
+// Approximate 5*log10(d) - 5: the exponent and top eight mantissa bits of
+// the double select a table entry, and a degree-2 series on the residual
+// fraction (|f| < 2^-8) brings the modulus within ~5e-8 magnitudes of the
+// exact value. Trades the libm log10 call for a table load and a few
+// multiply-adds; the 4KB table stays cached after the first chunk.
+static inline double DistanceModulusApprox(double dist) {
+    uint64_t bits;
+    memcpy(&bits, &dist, sizeof(bits));
+    double exponent = double(int64_t(bits >> 52) - 1023);
+    uint64_t mantissa = bits & 0x000FFFFFFFFFFFFFULL;
+    idx_t idx = idx_t(mantissa >> 44);
+    double m = 1.0 + double(mantissa) * 2.220446049250313e-16;  // 2^-52
+    double f = m * LOG10_LUT.inv_base[idx] - 1.0;
+    double log10_d = MulAdd(exponent, LOG10_2, LOG10_LUT.log10_hi[idx]) + LOG10_E * (f - 0.5 * f * f);
+    double dm = MulAdd(5.0, log10_d, -5.0);
+    return dist > 0 ? dm : std::numeric_limits<double>::quiet_NaN();
+}
+
+static void DistanceModulusFastKernel(const double *dist, double *out, idx_t count) {
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        out[i] = DistanceModulusApprox(dist[i]);
+    }
+}
+
+static void AstroDistanceModulusFast(DataChunk &args, ExpressionState &state, Vector &result) {
+    if (IsFlatNoNulls(args.data[0])) {
+        result.SetVectorType(VectorType::FLAT_VECTOR);
+        DistanceModulusFastKernel(FlatVector::GetData<double>(args.data[0]),
+                                  FlatVector::GetData<double>(result), args.size());
+        return;
+    }
+    UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(), DistanceModulusApprox);
+}
+
+// Same unconditional-log10 + select shape as the other photometry kernels
+static void AbsoluteMagKernel(const double *app_mag, const double *dist, double *out, idx_t count) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        double abs_mag = MulAdd(-5.0, log10(dist[i]), app_mag[i] + 5.0);
+        out[i] = dist[i] > 0 ? abs_mag : nan;
+    }
+}
+
 static void AstroAbsoluteMag(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1])) {
+        // Constant distance: the whole log10 term collapses to one addend
+        // (NaN for a non-positive distance, which then propagates per row)
+        const double dist_pc = ConstantVector::GetData<double>(args.data[1])[0];
+        const double corr = dist_pc > 0 ? 5.0 - 5.0 * log10(dist_pc)
+                                        : std::numeric_limits<double>::quiet_NaN();
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [corr](double app_mag) { return app_mag + corr; });
+        return;
+    }
+    BinaryBatchDispatch<AbsoluteMagKernel>(args, result,
         [](double app_mag, double dist_pc) {
-            return dist_pc > 0 ? app_mag - 5.0 * log10(dist_pc) + 5.0 : std::numeric_limits<double>::quiet_NaN();
+            double abs_mag = MulAdd(-5.0, log10(dist_pc), app_mag + 5.0);
+            return dist_pc > 0 ? abs_mag : std::numeric_limits<double>::quiet_NaN();
         });
 }
 
 // ============================================================================
 // COSMOLOGY FUNCTIONS
 // ============================================================================
+// A non-constant H0 column still tends to repeat (a handful of survey
+// values), so the reciprocal is memoized across runs of equal values:
+// the divide is paid once per change of H0 and each row is a multiply.
+static void LuminosityDistanceKernel(const double *z, const double *H0, double *out, idx_t count) {
+    if (count == 0) {
+        return;
+    }
+    double run_H0 = H0[0];
+    double run_k = CONST_C_KM / run_H0;
+    for (idx_t i = 0; i < count; i++) {
+        if (H0[i] != run_H0) {
+            run_H0 = H0[i];
+            run_k = CONST_C_KM / run_H0;
+        }
+        out[i] = run_k * z[i];
+    }
+}
+
 static void AstroLuminosityDistance(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1])) {
+        // Constant H0 (the usual case): one divide per chunk, one multiply per row
+        const double k = CONST_C_KM / ConstantVector::GetData<double>(args.data[1])[0];
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [k](double z) { return k * z; });
+        return;
+    }
+    BinaryBatchDispatch<LuminosityDistanceKernel>(args, result,
         [](double z, double H0) {
             // Simple Hubble law approximation (valid for z << 1)
-            return (CONST_C / 1000.0) * z / H0;  // Mpc
+            return CONST_C_KM * z / H0;  // Mpc
         });
 }
 
+static void ComovingDistanceKernel(const double *z, const double *H0, double *out, idx_t count) {
+    ASTRO_SIMD_LOOP
+    for (idx_t i = 0; i < count; i++) {
+        // Fused denominator: one divide instead of /H0 then /(1+z)
+        out[i] = CONST_C_KM * z[i] / (H0[i] * (1.0 + z[i]));
+    }
+}
+
 static void AstroComovingDistance(DataChunk &args, ExpressionState &state, Vector &result) {
-    BinaryExecutor::Execute<double, double, double>(
-        args.data[0], args.data[1], result, args.size(),
+    if (args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR &&
+        !ConstantVector::IsNull(args.data[1])) {
+        const double k = CONST_C_KM / ConstantVector::GetData<double>(args.data[1])[0];
+        UnaryExecutor::Execute<double, double>(args.data[0], result, args.size(),
+            [k](double z) { return k * z / (1.0 + z); });
+        return;
+    }
+    BinaryBatchDispatch<ComovingDistanceKernel>(args, result,
         [](double z, double H0) {
-            return (CONST_C / 1000.0) * z / H0 / (1.0 + z);  // Mpc
+            return CONST_C_KM * z / (H0 * (1.0 + z));  // Mpc
         });
 }
 
+// Both Hubble-law distances in one pass: d_L is computed once and the
+// comoving distance reuses it, so queries that need both pay for the
+// shared (c/1000)*z/H0 term a single time.
+static void AstroCosmoDistances(DataChunk &args, ExpressionState &state, Vector &result) {
+    auto &children = StructVector::GetEntries(result);
+    auto dl_out = FlatVector::GetData<double>(*children[0]);
+    auto dc_out = FlatVector::GetData<double>(*children[1]);
+
+    if (IsFlatNoNulls(args.data[0]) && IsFlatNoNulls(args.data[1])) {
+        auto z = FlatVector::GetData<double>(args.data[0]);
+        auto H0 = FlatVector::GetData<double>(args.data[1]);
+        // Same run-memoized reciprocal as LuminosityDistanceKernel, leaving
+        // only the 1/(1+z) divide per row
+        double run_H0 = H0[0];
+        double run_k = CONST_C_KM / run_H0;
+        for (idx_t i = 0; i < args.size(); i++) {
+            if (H0[i] != run_H0) {
+                run_H0 = H0[i];
+                run_k = CONST_C_KM / run_H0;
+            }
+            double d_l = run_k * z[i];
+            dl_out[i] = d_l;
+            dc_out[i] = d_l / (1.0 + z[i]);
+        }
+        return;
+    }
+
+    UnifiedVectorFormat z_fmt, h_fmt;
+    args.data[0].ToUnifiedFormat(args.size(), z_fmt);
+    args.data[1].ToUnifiedFormat(args.size(), h_fmt);
+    auto z_ptr = UnifiedVectorFormat::GetData<double>(z_fmt);
+    auto h_ptr = UnifiedVectorFormat::GetData<double>(h_fmt);
+
+    for (idx_t i = 0; i < args.size(); i++) {
+        auto z_idx = z_fmt.sel->get_index(i);
+        auto h_idx = h_fmt.sel->get_index(i);
+        // A NULL in either input nulls the whole struct row, matching the
+        // BinaryExecutor semantics of the single-distance functions
+        if (!z_fmt.validity.RowIsValid(z_idx) || !h_fmt.validity.RowIsValid(h_idx)) {
+            FlatVector::SetNull(result, i, true);
+            continue;
+        }
+        double z = z_ptr[z_idx];
+        double d_l = CONST_C_KM * z / h_ptr[h_idx];
+        dl_out[i] = d_l;
+        dc_out[i] = d_l / (1.0 + z);
+    }
+}
+
+// ============================================================================
+// FLOAT32 OVERLOADS
+// ============================================================================
+// REAL columns would otherwise bind through an implicit cast to DOUBLE in
+// front of every call. These thin overloads keep the data in float - half
+// the bytes per row, twice the SIMD lanes - and use the float libm entry
+// points. Plain executor lambdas are enough here: at float width the loops
+// are bandwidth-bound, not compute-bound.
+constexpr float LOG2_10_OVER_2P5_F = 1.3287712f;   // log2(10)/2.5
+constexpr float P2P5_OVER_LOG2_10_F = 0.7525750f;  // 2.5/log2(10)
+constexpr float CONST_C_KM_F = 299792.458f;
+
+static void AstroMagToFluxFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    BinaryExecutor::Execute<float, float, float>(args.data[0], args.data[1], result, args.size(),
+        [](float mag, float zp) { return exp2f((zp - mag) * LOG2_10_OVER_2P5_F); });
+}
+
+static void AstroFluxToMagFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    BinaryExecutor::Execute<float, float, float>(args.data[0], args.data[1], result, args.size(),
+        [](float flux, float zp) {
+            float safe = flux > 0 ? flux : 1.0f;
+            float mag = zp - P2P5_OVER_LOG2_10_F * log2f(safe);
+            return flux > 0 ? mag : std::numeric_limits<float>::quiet_NaN();
+        });
+}
+
+static void AstroDistanceModulusFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    UnaryExecutor::Execute<float, float>(args.data[0], result, args.size(),
+        [](float dist_pc) {
+            float dm = 5.0f * log10f(dist_pc) - 5.0f;
+            return dist_pc > 0 ? dm : std::numeric_limits<float>::quiet_NaN();
+        });
+}
+
+static void AstroAbsoluteMagFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    BinaryExecutor::Execute<float, float, float>(args.data[0], args.data[1], result, args.size(),
+        [](float app_mag, float dist_pc) {
+            float abs_mag = app_mag - 5.0f * log10f(dist_pc) + 5.0f;
+            return dist_pc > 0 ? abs_mag : std::numeric_limits<float>::quiet_NaN();
+        });
+}
+
+static void AstroLuminosityDistanceFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    BinaryExecutor::Execute<float, float, float>(args.data[0], args.data[1], result, args.size(),
+        [](float z, float H0) { return CONST_C_KM_F * z / H0; });
+}
+
+static void AstroComovingDistanceFloat(DataChunk &args, ExpressionState &state, Vector &result) {
+    BinaryExecutor::Execute<float, float, float>(args.data[0], args.data[1], result, args.size(),
+        [](float z, float H0) { return CONST_C_KM_F * z / (H0 * (1.0f + z)); });
+}
+
 // ============================================================================
 // EXTENSION REGISTRATION
 // ============================================================================
 // Note: DuckDB provides radians(), degrees(), pi() - no need to duplicate
+
+// Stamp a pure function as CONSISTENT so the planner can constant-fold
+// calls whose arguments are all literals; with default null handling the
+// framework also short-circuits NULL rows before the kernel runs.
+static void RegisterConsistent(ExtensionLoader &loader, ScalarFunction fn) {
+    fn.stability = FunctionStability::CONSISTENT;
+    loader.RegisterFunction(fn);
+}
+
+static void RegisterConstant(ExtensionLoader &loader, const char *name, scalar_function_t fn,
+                             function_bind_expression_t bind_expr) {
+    ScalarFunction f(name, {}, LogicalType::DOUBLE, fn);
+    f.stability = FunctionStability::CONSISTENT;
+    f.bind_expression = bind_expr;
+    loader.RegisterFunction(f);
+}
+
+// Registers a DOUBLE implementation together with its REAL overload under
+// one name, so the binder picks the exact-match kernel and never inserts a
+// float-to-double cast.
+static void RegisterConsistentPair(ExtensionLoader &loader, ScalarFunction double_fn, ScalarFunction float_fn) {
+    double_fn.stability = FunctionStability::CONSISTENT;
+    float_fn.stability = FunctionStability::CONSISTENT;
+    ScalarFunctionSet set(double_fn.name);
+    set.AddFunction(std::move(double_fn));
+    set.AddFunction(std::move(float_fn));
+    loader.RegisterFunction(set);
+}
+
+// Registration tables for the homogeneous function groups. Keeping these
+// as data instead of one call per function keeps LoadInternal small and
+// extension-load cost flat as the surface grows; the heterogeneous
+// signatures below stay as explicit calls.
+typedef void (*astro_scalar_fn_t)(DataChunk &, ExpressionState &, Vector &);
+
+struct ConstFnDesc {
+    const char *name;
+    astro_scalar_fn_t fn;
+    function_bind_expression_t bind_expr;
+};
+
+static const ConstFnDesc CONST_FNS[] = {
+    {"astro_const_c", AstroConstC, AstroConstCExpr},
+    {"astro_const_G", AstroConstG, AstroConstGExpr},
+    {"astro_const_M_sun", AstroConstMSun, AstroConstMSunExpr},
+    {"astro_const_R_sun", AstroConstRSun, AstroConstRSunExpr},
+    {"astro_const_L_sun", AstroConstLSun, AstroConstLSunExpr},
+    {"astro_const_M_earth", AstroConstMEarth, AstroConstMEarthExpr},
+    {"astro_const_R_earth", AstroConstREarth, AstroConstREarthExpr},
+    {"astro_const_AU", AstroConstAU, AstroConstAUExpr},
+    {"astro_const_pc", AstroConstPc, AstroConstPcExpr},
+    {"astro_const_ly", AstroConstLy, AstroConstLyExpr},
+    {"astro_const_sigma_sb", AstroConstSigmaSB, AstroConstSigmaSBExpr},
+};
+
+// DOUBLE -> DOUBLE unit wrappers
+struct UnitFnDesc {
+    const char *name;
+    astro_scalar_fn_t fn;
+};
+
+static const UnitFnDesc UNIT_FNS[] = {
+    {"astro_unit_AU", AstroUnitAU},
+    {"astro_unit_pc", AstroUnitpc},
+    {"astro_unit_ly", AstroUnitly},
+    {"astro_unit_M_sun", AstroUnitM_sun},
+    {"astro_unit_M_earth", AstroUnitM_earth},
+};
+
+// DOUBLE... -> ASTRO_BODY constructors (all unary except the asteroid)
+struct BodyFnDesc {
+    const char *name;
+    astro_scalar_fn_t fn;
+    idx_t arg_count;
+};
+
+static const BodyFnDesc BODY_FNS[] = {
+    {"astro_body_star_ms", AstroBodyMakeStarMs, 1},
+    {"astro_body_star_white_dwarf", AstroBodyMakeStarWhiteDwarf, 1},
+    {"astro_body_star_neutron", AstroBodyMakeStarNeutron, 1},
+    {"astro_body_brown_dwarf", AstroBodyMakeBrownDwarf, 1},
+    {"astro_body_black_hole", AstroBodyMakeBlackHole, 1},
+    {"astro_body_planet_rocky", AstroBodyMakePlanetRocky, 1},
+    {"astro_body_planet_gas_giant", AstroBodyMakePlanetGasGiant, 1},
+    {"astro_body_planet_ice_giant", AstroBodyMakePlanetIceGiant, 1},
+    {"astro_body_asteroid", AstroBodyMakeAsteroid, 2},
+};
+
 static void LoadInternal(ExtensionLoader &loader) {
     auto pos_type = GetAstroPosType();
     auto vel_type = GetAstroVelType();
@@ -1048,40 +2248,23 @@ static void LoadInternal(ExtensionLoader &loader) {
     auto bounds_type = GetSectorBoundsType();
 
     // Constants
-    loader.RegisterFunction(ScalarFunction("astro_const_c", {}, LogicalType::DOUBLE, AstroConstC));
-    loader.RegisterFunction(ScalarFunction("astro_const_G", {}, LogicalType::DOUBLE, AstroConstG));
-    loader.RegisterFunction(ScalarFunction("astro_const_M_sun", {}, LogicalType::DOUBLE, AstroConstMSun));
-    loader.RegisterFunction(ScalarFunction("astro_const_R_sun", {}, LogicalType::DOUBLE, AstroConstRSun));
-    loader.RegisterFunction(ScalarFunction("astro_const_L_sun", {}, LogicalType::DOUBLE, AstroConstLSun));
-    loader.RegisterFunction(ScalarFunction("astro_const_M_earth", {}, LogicalType::DOUBLE, AstroConstMEarth));
-    loader.RegisterFunction(ScalarFunction("astro_const_R_earth", {}, LogicalType::DOUBLE, AstroConstREarth));
-    loader.RegisterFunction(ScalarFunction("astro_const_AU", {}, LogicalType::DOUBLE, AstroConstAU));
-    loader.RegisterFunction(ScalarFunction("astro_const_pc", {}, LogicalType::DOUBLE, AstroConstPc));
-    loader.RegisterFunction(ScalarFunction("astro_const_ly", {}, LogicalType::DOUBLE, AstroConstLy));
-    loader.RegisterFunction(ScalarFunction("astro_const_sigma_sb", {}, LogicalType::DOUBLE, AstroConstSigmaSB));
+    for (auto &desc : CONST_FNS) {
+        RegisterConstant(loader, desc.name, desc.fn, desc.bind_expr);
+    }
 
     // Unit conversions
-    loader.RegisterFunction(ScalarFunction("astro_unit_length_to_m", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitLengthToM));
-    loader.RegisterFunction(ScalarFunction("astro_unit_mass_to_kg", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitMassToKg));
-    loader.RegisterFunction(ScalarFunction("astro_unit_time_to_s", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitTimeToS));
-    loader.RegisterFunction(ScalarFunction("astro_unit_AU", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroUnitAU));
-    loader.RegisterFunction(ScalarFunction("astro_unit_pc", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroUnitpc));
-    loader.RegisterFunction(ScalarFunction("astro_unit_ly", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroUnitly));
-    loader.RegisterFunction(ScalarFunction("astro_unit_M_sun", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroUnitM_sun));
-    loader.RegisterFunction(ScalarFunction("astro_unit_M_earth", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroUnitM_earth));
-
-    // Body models - Stars
-    loader.RegisterFunction(ScalarFunction("astro_body_star_ms", {LogicalType::DOUBLE}, body_type, AstroBodyMakeStarMs));
-    loader.RegisterFunction(ScalarFunction("astro_body_star_white_dwarf", {LogicalType::DOUBLE}, body_type, AstroBodyMakeStarWhiteDwarf));
-    loader.RegisterFunction(ScalarFunction("astro_body_star_neutron", {LogicalType::DOUBLE}, body_type, AstroBodyMakeStarNeutron));
-    loader.RegisterFunction(ScalarFunction("astro_body_brown_dwarf", {LogicalType::DOUBLE}, body_type, AstroBodyMakeBrownDwarf));
-    loader.RegisterFunction(ScalarFunction("astro_body_black_hole", {LogicalType::DOUBLE}, body_type, AstroBodyMakeBlackHole));
-    // Body models - Planets
-    loader.RegisterFunction(ScalarFunction("astro_body_planet_rocky", {LogicalType::DOUBLE}, body_type, AstroBodyMakePlanetRocky));
-    loader.RegisterFunction(ScalarFunction("astro_body_planet_gas_giant", {LogicalType::DOUBLE}, body_type, AstroBodyMakePlanetGasGiant));
-    loader.RegisterFunction(ScalarFunction("astro_body_planet_ice_giant", {LogicalType::DOUBLE}, body_type, AstroBodyMakePlanetIceGiant));
-    // Body models - Small bodies
-    loader.RegisterFunction(ScalarFunction("astro_body_asteroid", {LogicalType::DOUBLE, LogicalType::DOUBLE}, body_type, AstroBodyMakeAsteroid));
+    loader.RegisterFunction(ScalarFunction("astro_unit_length_to_m", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitLengthToM, UnitBind<ResolveLengthFactor>));
+    loader.RegisterFunction(ScalarFunction("astro_unit_mass_to_kg", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitMassToKg, UnitBind<ResolveMassFactor>));
+    loader.RegisterFunction(ScalarFunction("astro_unit_time_to_s", {LogicalType::DOUBLE, LogicalType::VARCHAR}, LogicalType::DOUBLE, AstroUnitTimeToS, UnitBind<ResolveTimeFactor>));
+    for (auto &desc : UNIT_FNS) {
+        RegisterConsistent(loader, ScalarFunction(desc.name, {LogicalType::DOUBLE}, LogicalType::DOUBLE, desc.fn));
+    }
+
+    // Body models
+    for (auto &desc : BODY_FNS) {
+        vector<LogicalType> body_args(desc.arg_count, LogicalType::DOUBLE);
+        loader.RegisterFunction(ScalarFunction(desc.name, std::move(body_args), body_type, desc.fn));
+    }
 
     // Orbit functions
     loader.RegisterFunction(ScalarFunction("astro_orbit_make",
@@ -1108,18 +2291,33 @@ static void LoadInternal(ExtensionLoader &loader) {
     loader.RegisterFunction(ScalarFunction("astro_sector_parent", {sector_type}, sector_type, AstroSectorParent));
 
     // Coordinates
-    loader.RegisterFunction(ScalarFunction("astro_radec_to_xyz", {LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE}, pos_type, AstroRadecToXyz));
-    loader.RegisterFunction(ScalarFunction("astro_angular_separation", {LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroAngularSeparation));
+    RegisterConsistent(loader, ScalarFunction("astro_radec_to_xyz", {LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE}, pos_type, AstroRadecToXyz));
+    RegisterConsistent(loader, ScalarFunction("astro_angular_separation", {LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroAngularSeparation));
+    RegisterConsistent(loader, ScalarFunction("astro_angular_separation_cos", {LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroAngularSeparationCos));
 
     // Photometry
-    loader.RegisterFunction(ScalarFunction("astro_mag_to_flux", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroMagToFlux));
-    loader.RegisterFunction(ScalarFunction("astro_flux_to_mag", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroFluxToMag));
-    loader.RegisterFunction(ScalarFunction("astro_distance_modulus", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroDistanceModulus));
-    loader.RegisterFunction(ScalarFunction("astro_absolute_mag", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroAbsoluteMag));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_mag_to_flux", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroMagToFlux),
+        ScalarFunction("astro_mag_to_flux", {LogicalType::FLOAT, LogicalType::FLOAT}, LogicalType::FLOAT, AstroMagToFluxFloat));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_flux_to_mag", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroFluxToMag),
+        ScalarFunction("astro_flux_to_mag", {LogicalType::FLOAT, LogicalType::FLOAT}, LogicalType::FLOAT, AstroFluxToMagFloat));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_distance_modulus", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroDistanceModulus),
+        ScalarFunction("astro_distance_modulus", {LogicalType::FLOAT}, LogicalType::FLOAT, AstroDistanceModulusFloat));
+    RegisterConsistent(loader, ScalarFunction("astro_distance_modulus_fast", {LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroDistanceModulusFast));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_absolute_mag", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroAbsoluteMag),
+        ScalarFunction("astro_absolute_mag", {LogicalType::FLOAT, LogicalType::FLOAT}, LogicalType::FLOAT, AstroAbsoluteMagFloat));
 
     // Cosmology
-    loader.RegisterFunction(ScalarFunction("astro_luminosity_distance", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroLuminosityDistance));
-    loader.RegisterFunction(ScalarFunction("astro_comoving_distance", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroComovingDistance));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_luminosity_distance", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroLuminosityDistance),
+        ScalarFunction("astro_luminosity_distance", {LogicalType::FLOAT, LogicalType::FLOAT}, LogicalType::FLOAT, AstroLuminosityDistanceFloat));
+    RegisterConsistentPair(loader,
+        ScalarFunction("astro_comoving_distance", {LogicalType::DOUBLE, LogicalType::DOUBLE}, LogicalType::DOUBLE, AstroComovingDistance),
+        ScalarFunction("astro_comoving_distance", {LogicalType::FLOAT, LogicalType::FLOAT}, LogicalType::FLOAT, AstroComovingDistanceFloat));
+    RegisterConsistent(loader, ScalarFunction("astro_cosmo_distances", {LogicalType::DOUBLE, LogicalType::DOUBLE}, GetCosmoDistancesType(), AstroCosmoDistances));
 }
 
 void AstroExtension::Load(ExtensionLoader &loader) {
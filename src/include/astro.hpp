@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cmath>
+
+// Windows MSVC doesn't define M_PI by default
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace duckdb {
+
+// Shared angle-conversion constants. Kept in one place so scalar code and
+// batched kernels broadcast the same literals.
+constexpr double DEG_TO_RAD = 0.017453292519943295;  // M_PI / 180
+constexpr double RAD_TO_DEG = 57.29577951308232;     // 180 / M_PI
+
+// Plain-value 3-vector. Returned by value from the coordinate helpers so
+// results stay in registers - never heap-allocate per-row geometry.
+struct Vec3 {
+	double x, y, z;
+	Vec3() : x(0), y(0), z(0) {}
+	Vec3(double x_, double y_, double z_) : x(x_), y(y_), z(z_) {}
+
+	Vec3 operator+(const Vec3 &o) const { return {x + o.x, y + o.y, z + o.z}; }
+	Vec3 operator-(const Vec3 &o) const { return {x - o.x, y - o.y, z - o.z}; }
+	Vec3 operator*(double s) const { return {x * s, y * s, z * s}; }
+	double dot(const Vec3 &o) const { return x * o.x + y * o.y + z * o.z; }
+	double length() const { return sqrt(x * x + y * y + z * z); }
+	double length2() const { return x * x + y * y + z * z; }
+};
+
+} // namespace duckdb
@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 """
 Test Suite for Astro DuckDB Extension
-Tests all 48 astronomical functions
+Tests all 51 astronomical functions
 """
 
 import subprocess
@@ -136,6 +136,7 @@ def main():
     # Coordinate Functions
     p, f = test_group("Coordinate Transformations", [
         ("Angular separation", "SELECT astro_angular_separation(0.0, 0.0, 1.0, 1.0);"),
+        ("Angular separation cos", "SELECT astro_angular_separation_cos(0.0, 0.0, 1.0, 1.0);"),
         ("RA/Dec to XYZ", "SELECT astro_radec_to_xyz(45.0, 30.0, 10.0);"),
     ])
     total_passed += p
@@ -147,6 +148,7 @@ def main():
         ("Flux to magnitude", "SELECT astro_flux_to_mag(1000.0, 25.0);"),
         ("Absolute magnitude", "SELECT astro_absolute_mag(10.0, 100.0);"),
         ("Distance modulus", "SELECT astro_distance_modulus(1000.0);"),
+        ("Distance modulus (fast)", "SELECT astro_distance_modulus_fast(1000.0);"),
     ])
     total_passed += p
     total_failed += f
@@ -155,6 +157,7 @@ def main():
     p, f = test_group("Cosmology", [
         ("Luminosity distance", "SELECT astro_luminosity_distance(0.1, 70.0);"),
         ("Comoving distance", "SELECT astro_comoving_distance(1.0, 70.0);"),
+        ("Cosmo distances struct", "SELECT astro_cosmo_distances(0.1, 70.0);"),
     ])
     total_passed += p
     total_failed += f